@@ -0,0 +1,251 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       auton-routines.h                                          */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Step tables for every autonomous routine                  */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include "auton-steps.h"
+
+// Include from one file per program (main.cpp on the robot).
+//
+// Planned times come from step-time.h (make check in tools prints them
+// with -v and fails when one is more than 25% off), so they're only as
+// good as the limits in motion-limits.h. Check them against the timing
+// report after a run.
+
+// {kind, amount, velocity, wait, priority, expected msec}, and a square
+// adds {..., axis, axisValue}, e.g. back into the wall behind the start:
+//    {stepSquare, 0, -1, true, stepRequired, 800, stepAxisY, 0}
+
+const autonStep skillsSteps[] = {
+    // lower back lift
+    {stepBack, 500, 80, true, stepRequired, 1250},
+    // drive enough for back lift to be under goal to starting position
+    {stepDrive, -12, 70, true, stepRequired, 1000},
+    // wait to ensure it is on lift
+    {stepWait, 300, 0, true, stepOptional, 300},
+    // pick up goal on platform with the back
+    {stepBack, -440, 80, true, stepRequired, 1150},
+    // turn to head to left yellow goal
+    {stepTurn, 83, 0, true, stepRequired, 1200},
+    // drive forward then turn to allow claw to face goal
+    {stepDriveTo, 2.0, 0, true, stepRequired, 1600},
+    {stepTurn, 91, 0, true, stepRequired, 550},
+    // drive till the yellow goal is reached
+    {stepDriveTo, 2.3, 0, true, stepRequired, 1700},
+    // spin claw and lift to pick up left yellow goal
+    {stepClaw, -140, 80, true, stepRequired, 500},
+    {stepLift, -320, 80, true, stepRequired, 900},
+    // drive forward holding goal
+    {stepDrive, 32, 90, true, stepRequired, 1600},
+    {stepWait, 200, 0, true, stepOptional, 200},
+    // turn to start reaching platform
+    {stepTurn, 133, 0, true, stepRequired, 950},
+    // robot should be in front of platform at an angle
+    {stepDrive, 14, 80, true, stepRequired, 1050},
+    // raise the lift
+    {stepLift, -900, 80, true, stepRequired, 2100},
+    // drive closer to the goal
+    {stepDrive, 8, 15, true, stepRequired, 1450},
+    // turn to be parallel with platform
+    {stepTurn, 179, 0, true, stepRequired, 950},
+    // front wheels in line with platform stand, retry if caught on it
+    {stepDriveRetry, 6.5, 40, true, stepRequired, 750},
+    // wait to stop drift
+    {stepWait, 200, 0, true, stepOptional, 200},
+    // spin only the right side to slide in between the platform stand
+    {stepRightSide, 750, 60, true, stepRequired, 1200},
+    {stepDrive, 2, 60, true, stepRequired, 450},
+    // lower lift and release claw
+    {stepLift, 550, 90, true, stepRequired, 1250},
+    {stepClaw, 100, 90, true, stepRequired, 400},
+    // reverse enough to drop goal
+    {stepDrive, -5, 60, true, stepRequired, 700},
+    // raise lift to get over platform edge
+    {stepLift, -100, 80, true, stepRequired, 400},
+    // back out of platform
+    {stepDrive, -4, 60, true, stepRequired, 600},
+    // return lift and claw to starting position
+    {stepClaw, 40, 90, false, stepRequired, 0},
+    {stepLift, 900, 90, true, stepRequired, 1900},
+    {stepTurn, 180, 0, true, stepRequired, 350},
+    // lower the back
+    {stepBack, 450, 90, true, stepRequired, 1050},
+    {stepDrive, 14, 70, true, stepRequired, 1050},
+    // drop goal in back lift
+    {stepBack, -400, 80, true, stepRequired, 1050},
+    // turn to face goal with claw
+    {stepTurn, 0, 0, true, stepRequired, 1650},
+    // drive to reach alliance goal
+    {stepDrive, 14.5, 65, true, stepRequired, 1100},
+    // pick up the goal and raise it
+    {stepClaw, -140, 80, true, stepRequired, 500},
+    {stepLift, -1100, 80, true, stepRequired, 2500},
+    // turn to platform
+    {stepTurn, 70, 0, true, stepRequired, 1150},
+    {stepDrive, 10, 40, true, stepRequired, 1000},
+    {stepTurn, 105, 0, true, stepRequired, 850},
+    {stepDrive, 7, 40, true, stepRequired, 800},
+    // push neutral goal toward side
+    {stepLift, 250, 80, true, stepRequired, 750},
+    {stepClaw, 100, 90, true, stepRequired, 400},
+    {stepDrive, -7.5, 60, true, stepRequired, 800},
+    {stepLift, -150, 80, true, stepRequired, 500},
+    {stepDrive, -7.5, 60, true, stepRequired, 800},
+    // drop goal and return lift to position
+    {stepClaw, 40, 90, false, stepRequired, 0},
+    {stepLift, 900, 90, true, stepRequired, 1900},
+    // turn to alliance corner goal
+    {stepTurn, 185, 0, true, stepRequired, 1200},
+    {stepDrive, -13.5, 60, false, stepRequired, 0},
+    {stepBack, 400, 70, true, stepRequired, 1150},
+    // back into the corner goal
+    {stepDrive, -25, 60, true, stepRequired, 1500},
+    {stepBack, -400, 90, true, stepRequired, 950},
+    {stepTurn, 210, 0, true, stepOptional, 800},
+    // cross the field
+    {stepDrive, 127, 60, true, stepOptional, 5550}};
+const autonRoutine skillsRoutine = {
+    "Skills", skillsSteps,
+    sizeof(skillsSteps) / sizeof(autonStep), 60000};
+
+const autonStep l1YellowSteps[] = {
+    // spin back u lift to resting on the ground
+    {stepBack, 500, 100, false, stepRequired, 0},
+    // wait so the lift is down far enough before driving
+    {stepWait, 200, 0, true, stepRequired, 200},
+    // drive towards the goal
+    {stepDrive, -50, 100, true, stepRequired, 2000},
+    // spin back u lift up so the goal is nestled
+    {stepBack, -300, 80, true, stepRequired, 850},
+    // drive back to start
+    {stepDriveTo, 4.36, 0, true, stepRequired, 2550}};
+const autonRoutine l1YellowRoutine = {
+    "L1Yellow", l1YellowSteps,
+    sizeof(l1YellowSteps) / sizeof(autonStep), 15000};
+
+const autonStep l2YellowSteps[] = {
+    // spin back u lift to resting on the ground
+    {stepBack, 500, 100, false, stepRequired, 0},
+    // wait so the lift is down far enough before driving
+    {stepWait, 200, 0, true, stepRequired, 200},
+    // drive towards the goal
+    {stepDrive, -50, 100, true, stepRequired, 2000},
+    // spin back u lift up so the goal is nestled
+    {stepBack, -300, 80, true, stepRequired, 850},
+    // turn to face an angle to avoid rings
+    {stepTurn, -84, 0, true, stepRequired, 1200},
+    // drive most of  the way to the middle neutral goal
+    {stepDrive, 15, 100, true, stepRequired, 1100},
+    // turn to face the goal
+    {stepTurn, -130, 0, true, stepRequired, 950},
+    {stepWait, 200, 0, true, stepOptional, 200},
+    // drive to goal
+    {stepDrive, 5, 60, true, stepRequired, 700},
+    // wait to make sure no skiding
+    {stepWait, 200, 0, true, stepOptional, 200},
+    // clamp the claw down
+    {stepClaw, -140, 80, true, stepRequired, 500},
+    // turn with goal
+    {stepTurn, 10, 0, true, stepRequired, 1500},
+    // drive back to start
+    {stepDrive, 30, 90, true, stepRequired, 1500}};
+const autonRoutine l2YellowRoutine = {
+    "L2Yellow", l2YellowSteps,
+    sizeof(l2YellowSteps) / sizeof(autonStep), 15000};
+
+const autonStep r1YellowSteps[] = {
+    {stepDrive, 43, 100, true, stepRequired, 1800},
+    {stepWait, 200, 0, true, stepOptional, 200},
+    {stepClaw, -130, 100, true, stepRequired, 450},
+    {stepDrive, -42, 100, true, stepRequired, 1800}};
+const autonRoutine r1YellowRoutine = {
+    "R1Normal", r1YellowSteps,
+    sizeof(r1YellowSteps) / sizeof(autonStep), 15000};
+
+const autonStep r2YellowSteps[] = {
+    // Drive until at goal
+    {stepDriveTo, 3.78, 0, true, stepRequired, 2300},
+    // Grab goal and pick up lift to avoid drag
+    {stepClaw, -140, 80, true, stepRequired, 500},
+    {stepLift, -120, 90, true, stepRequired, 450},
+    // reverse and turn until first goal is scored
+    {stepDrive, -12, 100, true, stepRequired, 1000},
+    {stepTurn, 120, 0, true, stepRequired, 1400},
+    // Drop the goal
+    {stepClaw, 130, 100, true, stepRequired, 450},
+    // Lower back lift
+    {stepBack, 500, 90, true, stepRequired, 1150},
+    // Reverse into middle goal and lift
+    {stepDrive, -32, 100, true, stepRequired, 1550},
+    {stepBack, -200, 90, true, stepRequired, 600},
+    // wait to ensure secure
+    {stepWait, 200, 0, true, stepOptional, 200},
+    // Drive until in the zone
+    {stepDrive, 14, 100, true, stepRequired, 1050},
+    // turn and drive until in line with goal
+    {stepTurn, 160, 0, true, stepOptional, 900},
+    {stepDrive, 27, 100, true, stepOptional, 1450},
+    // turn right so claw can pick up goal
+    {stepTurn, 90, 0, true, stepOptional, 1150}};
+const autonRoutine r2YellowRoutine = {
+    "R2Yellow", r2YellowSteps,
+    sizeof(r2YellowSteps) / sizeof(autonStep), 15000};
+
+const autonStep rMidOnlySteps[] = {
+    // Drive forward 18 inches
+    {stepDrive, 18, 100, true, stepRequired, 1200},
+    // Turn left to align with middle goal
+    {stepTurn, -38, 0, true, stepRequired, 900},
+    // Drive until at goal
+    {stepDrive, 38.5, 100, true, stepRequired, 1700},
+    // wait to ensure there is no skid
+    {stepWait, 200, 0, true, stepOptional, 200},
+    // Grab goal with claw
+    {stepClaw, -130, 80, true, stepRequired, 500},
+    // Drive reverse until scored
+    {stepDrive, -40, 100, true, stepRequired, 1750}};
+const autonRoutine rMidOnlyRoutine = {
+    "RMidOnly", rMidOnlySteps,
+    sizeof(rMidOnlySteps) / sizeof(autonStep), 15000};
+
+const autonStep lFront1Steps[] = {
+    // Use PID drive to drive 49 inches to goal
+    {stepDriveTo, 4.36, 0, true, stepRequired, 2550},
+    // Spin the claw down clutching goal
+    {stepClaw, -130, 100, true, stepRequired, 450},
+    // Reverse while holding goal until scored
+    {stepDrive, -50, 100, true, stepRequired, 2000}};
+const autonRoutine lFront1Routine = {
+    "LFront1", lFront1Steps,
+    sizeof(lFront1Steps) / sizeof(autonStep), 15000};
+
+const autonStep r1YellowPIDSteps[] = {
+    // Drive unitl goal
+    {stepDriveTo, 3.77, 0, true, stepRequired, 2300},
+    // Spin claw and drive away with goal
+    {stepClaw, -130, 100, true, stepRequired, 450},
+    {stepDrive, -42, 100, true, stepRequired, 1800}};
+const autonRoutine r1YellowPIDRoutine = {
+    "R1YellowPID", r1YellowPIDSteps,
+    sizeof(r1YellowPIDSteps) / sizeof(autonStep), 15000};
+
+const autonStep replaySteps[] = {
+    // whatever was last recorded from driver control. The runner gives it
+    // the recording's length (up to 60 s for skills) when that's longer
+    {stepReplay, 0, 0, true, stepRequired, 15000}};
+const autonRoutine replayRoutine = {
+    "Replay", replaySteps,
+    sizeof(replaySteps) / sizeof(autonStep), 15000};
+
+// Every routine, for the host tools
+const autonRoutine *const autonRoutines[] = {
+    &skillsRoutine,   &l1YellowRoutine, &l2YellowRoutine,
+    &r1YellowRoutine, &r2YellowRoutine, &rMidOnlyRoutine,
+    &lFront1Routine,  &r1YellowPIDRoutine, &replayRoutine};
+
+const int autonRoutineCount = sizeof(autonRoutines) / sizeof(autonRoutine *);
@@ -0,0 +1,51 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       auton-runner.h                                            */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Runs step tables against the match clock                  */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include "auton-steps.h"
+#include "vex.h"
+
+// Stage routines while disabled so autonomous() starts moving on its
+// first tick. Staging
+//    - sets the stopping modes
+//    - lays the routines' steps out in run order, with the required time
+//      after each one worked out
+//    - loads replay.bin when a routine replays it
+//    - checks the motors, gyro and SD card, problems show on the Auton page
+// selection is the selection count it was staged for, see autonPrepared
+void autonPrepare(const autonRoutine *const *routines, int count,
+                  int selection);
+
+// Whether what's staged is for this selection count
+bool autonPrepared(int selection);
+
+// Run the staged steps against the match clock, which starts at entry
+// (when autonomous() was called) and runs the longest staged matchLength.
+// Before each step the time left is checked
+//    - optional steps are skipped when they'd eat time the required steps
+//      after them need
+//    - any step is skipped with less than autonMinStep left
+//    - moves get a timeout, cut down to the time left (shortened)
+void autonRunPrepared(uint32_t entry);
+
+// What's staged, or what's wrong with it, for the Auton page
+const char *autonPrepareStatus(void);
+
+// msec from autonomous() to the first step starting, -1 before the first
+// autonomous. warm is whether it was staged ahead of time
+int32_t autonStartLatency(bool &warm);
+
+// Steps with less than this (msec) left aren't started
+extern uint32_t autonMinStep;
+
+// Print the planned against actual time and the wheel slips for each step
+// of the last autonomous and append it to auton-timing.csv. The ui task
+// calls this when autonomous ends, the routine itself is stopped at the
+// buzzer
+void autonReportLog(void);
@@ -0,0 +1,121 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       auton-steps.h                                             */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Autonomous routines as tables of steps                    */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include <stdint.h>
+
+// No vex.h in here, the host tools read the same tables
+
+// What a step does, and what amount means for it
+//    - stepDrive:      Drivetrain drive, inches (negative is reverse)
+//    - stepDriveRetry: same, but if it stalls back off 2 in and push the
+//                      last 2 in again (platform stand)
+//    - stepDriveTo:    driveTo PID, feet
+//    - stepTurn:       turnPID to an absolute rotation, degrees
+//    - stepRightSide:  right drive side only, motor degrees
+//    - stepBack, stepClaw, stepLift: mechanism, motor degrees (negative
+//                      is reverse)
+//    - stepWait:       msec
+//    - stepReplay:     play back replay.bin, amount unused
+//    - stepSquare:     push into a wall until flat and reset from it
+//                      (squareToWall), amount is the wall rotation in
+//                      degrees, negative velocity backs into it. Sets the
+//                      step's axis to axisValue if it has one
+enum stepKind {
+  stepDrive,
+  stepDriveRetry,
+  stepDriveTo,
+  stepTurn,
+  stepRightSide,
+  stepBack,
+  stepClaw,
+  stepLift,
+  stepWait,
+  stepReplay,
+  stepSquare
+};
+// Keep on the last kind
+const int stepKindCount = stepSquare + 1;
+
+// Names for the logs and the host tools, in stepKind order
+const char *const stepKindNames[] = {"drive", "drive retry", "driveTo",
+                                     "turn", "right side", "back", "claw",
+                                     "lift", "wait", "replay", "square"};
+static_assert(sizeof(stepKindNames) / sizeof(stepKindNames[0]) == stepKindCount,
+              "a name for every stepKind");
+
+// Optional steps are the first to go when time runs short, required ones
+// only get skipped or cut short when there's no time left at all
+enum stepPriority { stepRequired, stepOptional };
+
+// Pose axis a stepSquare wall pins down (poseAxis in wall-square.h)
+enum stepAxis { stepAxisNone, stepAxisX, stepAxisY };
+
+typedef struct _autonStep {
+  stepKind kind;
+  double amount;
+  // Percent, unused for driveTo/turn/wait and only the sign for square
+  double velocity;
+  // false starts the move and goes straight on to the next step
+  bool wait;
+  stepPriority priority;
+  // Planned msec before the next step can start (0 when not waiting)
+  uint32_t expected;
+  // stepSquare only, left out everywhere else: the pose axis the wall
+  // sets and its value there, inches
+  stepAxis axis;
+  double axisValue;
+} autonStep;
+
+typedef struct _autonRoutine {
+  const char *name;
+  const autonStep *steps;
+  int count;
+  // 15 s for a match, 60 s for skills
+  uint32_t matchLength;
+} autonRoutine;
+
+// Skip policy, shared by the runner and the host tools so they agree
+
+// Planned time the required steps after step index still need
+inline uint32_t stepRequiredAfter(const autonRoutine &routine, int index) {
+  uint32_t total = 0;
+  for (int i = index + 1; i < routine.count; i++)
+    if (routine.steps[i].priority == stepRequired)
+      total += routine.steps[i].expected;
+  return total;
+}
+
+// Default for the runner's autonMinStep (msec), the host tools use it too
+const uint32_t stepMinTime = 150;
+
+// Skip optional steps that would eat the required steps' time, and
+// anything with less than minStep msec left
+inline bool stepSkip(const autonStep &step, uint32_t requiredAfter,
+                     int32_t left, uint32_t minStep) {
+  if (left < (int32_t)minStep)
+    return true;
+  return step.priority == stepOptional &&
+         left < (int32_t)(step.expected + requiredAfter);
+}
+
+inline bool stepSkip(const autonRoutine &routine, int index, int32_t left,
+                     uint32_t minStep) {
+  return stepSkip(routine.steps[index], stepRequiredAfter(routine, index),
+                  left, minStep);
+}
+
+// Twice the plan is a stuck move, and nothing runs past the buzzer. A
+// replay goes on as long as it was recorded, so only the buzzer stops it
+inline uint32_t stepTimeout(const autonStep &step, int32_t left) {
+  if (step.kind == stepReplay)
+    return left > 0 ? (uint32_t)left : 0;
+  uint32_t timeout = step.expected * 2 + 500;
+  return timeout > (uint32_t)left ? (uint32_t)left : timeout;
+}
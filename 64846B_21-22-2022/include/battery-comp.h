@@ -0,0 +1,33 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       battery-comp.h                                            */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Battery voltage compensation for voltage-mode commands    */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include "vex.h"
+
+// Battery voltage the gains were tuned at. A voltage command of x volts
+// behaves like x volts at this battery voltage whatever the battery is at
+extern double batteryNominal;
+
+// Scale a voltage command for the current (filtered) battery voltage,
+// capped at the 12 V the motors accept. Use for every voltageUnits::volt spin
+double batteryCompensate(double volts);
+
+// Filtered battery voltage
+double batteryVoltageFiltered(void);
+
+// Sample, filter and keep stats. Called by the sensor task only, returns
+// the raw voltage
+double batteryUpdate(void);
+
+// Start a new stats period (e.g. when a match phase is enabled)
+void batteryStatsReset(void);
+
+// Print the stats for the period and append them to battery.csv on the
+// SD card if one is inserted
+void batteryStatsLog(const char *period);
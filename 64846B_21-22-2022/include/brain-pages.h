@@ -0,0 +1,35 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       brain-pages.h                                             */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Pages on the Brain screen, switched from a tab strip      */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include "vex.h"
+
+// Touching the strip at the top of the screen moves to the next page.
+// Everything under it belongs to the current page.
+const int pageTabHeight = 24;
+
+typedef struct _brainPage {
+  const char *name;
+  // Draw the page. full is true right after switching to it, so the page
+  // has to clear and redraw everything
+  void (*draw)(bool full);
+  // Touch under the tab strip, pressed is false on release (may be NULL)
+  void (*touch)(int xpos, int ypos, bool pressed);
+} brainPage;
+
+// Add a page, returns its index. The first page added is shown at startup
+int pageAdd(const brainPage &page);
+
+// Hook up the Brain screen pressed/released events
+void pageInit(void);
+
+// Redraw the current page, called from the ui task
+void pageDraw(void);
+
+int pageCurrent(void);
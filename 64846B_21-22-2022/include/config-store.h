@@ -0,0 +1,35 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       config-store.h                                            */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Tuning values saved to the SD card, edited on the Brain   */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include "vex.h"
+
+// config.bin layout, read straight into memory:
+//    header  magic "CFG1", version, value count, crc32 of the values
+//    values  one float per tunable, in the order of the table in
+//            config-store.cpp
+// New tunables go on the end of the table. An older file with fewer
+// values loads what it has, anything that doesn't check out is ignored
+// and the compiled defaults stay
+typedef struct _configHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t count;
+  uint32_t crc;
+} configHeader;
+
+// Remember the compiled values, load config.bin over them and add the
+// Config page. Call from pre_auton before anything uses the values
+void configInit(void);
+
+// Write the current values to config.bin, false if there's no SD card
+bool configSave(void);
+
+// Back to the compiled values (not saved until configSave)
+void configDefaults(void);
@@ -0,0 +1,50 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       drive-geometry.h                                          */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Measured wheel travel and track width                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+// No vex.h, the host tools use configuredGeometry
+
+// Inches per wheel turn and effective track width in inches (includes
+// scrub, so it's usually a bit wider than the tape measure says)
+typedef struct _driveGeometry {
+  double wheelTravel;
+  double trackWidth;
+} driveGeometry;
+
+// What Drivetrain was built with in robot-config.cpp (319.19 mm, 320 mm)
+const driveGeometry configuredGeometry = {319.19 / 25.4, 320 / 25.4};
+
+// Measured values, configuredGeometry until calibrated
+extern driveGeometry geometry;
+
+// Distance to put between the front of the robot and the wall for the
+// wheel travel test, inches
+extern double calibrationDistance;
+
+// Drivetrain can't be rebuilt, so distances given to it are scaled by
+// this to come out right
+inline double geometryDriveScale(void) {
+  return configuredGeometry.wheelTravel / geometry.wheelTravel;
+}
+
+// Encoder degrees to inches driven
+inline double geometryInches(double degrees) {
+  return degrees / 360 * geometry.wheelTravel;
+}
+
+// Load geometry.txt from the SD card (if present)
+void geometryLoad(void);
+
+// Calibration tests
+//    - wheel travel: face a wall calibrationDistance away, drive slowly
+//                    until the stall detector sees the wall
+//    - track width:  spin in place three turns, encoders against the
+//                    inertial sensor
+void calibrateWheelTravel(void);
+void calibrateTrackWidth(void);
@@ -0,0 +1,63 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       driver-control.h                                          */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Driver inputs and what they do to the robot               */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include "robot-state.h"
+#include "vex.h"
+
+// Period of the driver loop in msec (recordings replay at this rate too)
+const uint32_t driverPeriod = 20;
+
+// Bits for the buttons of one controller
+enum driverButton {
+  buttonL1 = 1 << 0,
+  buttonL2 = 1 << 1,
+  buttonR1 = 1 << 2,
+  buttonR2 = 1 << 3,
+  buttonUp = 1 << 4,
+  buttonDown = 1 << 5,
+  buttonLeft = 1 << 6,
+  buttonRight = 1 << 7,
+  buttonX = 1 << 8,
+  buttonB = 1 << 9,
+  buttonY = 1 << 10,
+  buttonA = 1 << 11
+};
+
+// Everything the driver loop acts on for one pass. Read from the
+// controllers live, or decoded from a recording when replaying
+typedef struct _driverInput {
+  // Controller1 Axis3 / Axis2 in percent
+  int left;
+  int right;
+  // driverButton bits for Controller1 and Controller2
+  uint16_t buttons1;
+  uint16_t buttons2;
+  // Toggles from Controller1 A (halfspeed) and B (solo)
+  bool halfspeed;
+  bool soloControl;
+} driverInput;
+
+// Register the halfspeed/solo/heading assist toggle buttons. Call once
+// per usercontrol
+void driverControlInit(void);
+
+void readDriverInput(driverInput &input);
+
+// Drive and mechanisms for one pass. The corrections (percent) are added to
+// each side of the chassis, replay uses them to hold the recorded path
+void applyDriverInput(const driverInput &input, double leftCorrection = 0,
+                      double rightCorrection = 0);
+
+// Heading hold for the tank drive (Controller1 X toggles it, on by
+// default). While both sticks ask for about the same speed, hold the
+// heading from when that started and return the side corrections for
+// applyDriverInput. Sticks apart or centered lets go straight away
+void headingHold(const driverInput &input, const robotState &state,
+                 double &leftCorrection, double &rightCorrection);
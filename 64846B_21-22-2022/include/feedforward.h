@@ -0,0 +1,47 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       feedforward.h                                             */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Drivetrain feedforward and its characterization tests     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include "vex.h"
+
+// volts = kS*sign(v) + kV*v + kA*a
+typedef struct _feedforward {
+  double kS;
+  double kV;
+  double kA;
+} feedforward;
+
+// Linear is per in/s, angular per deg/s. All zero until characterized,
+// and turnPID/driveTo only use feedforward when kV is set
+extern feedforward linearFF;
+extern feedforward angularFF;
+
+// Acceleration limits for the motion profiles (in/s^2 and deg/s^2)
+extern double linearMaxAccel;
+extern double angularMaxAccel;
+
+inline double feedforwardVolts(const feedforward &ff, double velocity,
+                               double acceleration) {
+  double sign = velocity > 0 ? 1 : (velocity < 0 ? -1 : 0);
+  return ff.kS * sign + ff.kV * velocity + ff.kA * acceleration;
+}
+
+// Fastest speed the profile may ask for when volts are available
+inline double feedforwardMaxVelocity(const feedforward &ff, double volts) {
+  return ff.kV > 0 ? (volts - ff.kS) / ff.kV : 0;
+}
+
+// Load fitted values from feedforward.txt on the SD card (if present)
+void feedforwardLoad(void);
+
+// Quasi-static and step voltage tests. They log ff-linear.csv or
+// ff-angular.csv to the SD card, fit, show and save the result.
+// Run with room to drive (linear) or turn in place (angular)
+void characterizeLinear(void);
+void characterizeAngular(void);
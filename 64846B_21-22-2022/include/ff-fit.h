@@ -0,0 +1,105 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       ff-fit.h                                                  */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  kS/kV/kA least squares fit (no vex code, host usable)     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include <math.h>
+
+// One logged point of a characterization run
+typedef struct _ffSample {
+  float time;     // sec
+  float volts;    // applied
+  float velocity; // in/s for linear, deg/s for angular
+} ffSample;
+
+typedef struct _ffFit {
+  double kS;
+  double kV;
+  double kA;
+  double rSquared;
+  int used;
+} ffFit;
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Fit volts = kS*sign(v) + kV*v + kA*a by least squares        */
+/*-----------------------------------------------------------------------------*/
+
+// Acceleration comes from a central difference of the velocity. Samples
+// slower than minVelocity are left out (the robot hasn't broken free yet).
+inline ffFit ffFitSamples(const ffSample *samples, int count,
+                          double minVelocity) {
+  // Normal equations A^T A x = A^T b with rows [sign(v), v, a]
+  double ata[3][3] = {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}};
+  double atb[3] = {0, 0, 0};
+  double sumV = 0, sumVV = 0;
+  ffFit fit = {0, 0, 0, 0, 0};
+
+  for (int i = 1; i + 1 < count; i++) {
+    double v = samples[i].velocity;
+    double dt = samples[i + 1].time - samples[i - 1].time;
+    if (fabs(v) < minVelocity || dt <= 0)
+      continue;
+
+    double row[3] = {v > 0 ? 1.0 : -1.0, v,
+                     (samples[i + 1].velocity - samples[i - 1].velocity) / dt};
+    double volts = samples[i].volts;
+    for (int r = 0; r < 3; r++) {
+      for (int c = 0; c < 3; c++)
+        ata[r][c] += row[r] * row[c];
+      atb[r] += row[r] * volts;
+    }
+    sumV += volts;
+    sumVV += volts * volts;
+    fit.used += 1;
+  }
+  if (fit.used < 3)
+    return fit;
+
+  // Gaussian elimination with partial pivoting
+  double m[3][4];
+  for (int r = 0; r < 3; r++) {
+    for (int c = 0; c < 3; c++)
+      m[r][c] = ata[r][c];
+    m[r][3] = atb[r];
+  }
+  for (int col = 0; col < 3; col++) {
+    int pivot = col;
+    for (int r = col + 1; r < 3; r++)
+      if (fabs(m[r][col]) > fabs(m[pivot][col]))
+        pivot = r;
+    if (fabs(m[pivot][col]) < 1e-12)
+      return fit;
+    for (int c = 0; c < 4; c++) {
+      double swap = m[col][c];
+      m[col][c] = m[pivot][c];
+      m[pivot][c] = swap;
+    }
+    for (int r = 0; r < 3; r++) {
+      if (r == col)
+        continue;
+      double factor = m[r][col] / m[col][col];
+      for (int c = col; c < 4; c++)
+        m[r][c] -= factor * m[col][c];
+    }
+  }
+  fit.kS = m[0][3] / m[0][0];
+  fit.kV = m[1][3] / m[1][1];
+  fit.kA = m[2][3] / m[2][2];
+
+  // R^2 = 1 - SSres/SStot, SSres from the normal equations
+  double x[3] = {fit.kS, fit.kV, fit.kA};
+  double ssRes = sumVV;
+  for (int r = 0; r < 3; r++) {
+    ssRes -= 2 * x[r] * atb[r];
+    for (int c = 0; c < 3; c++)
+      ssRes += x[r] * ata[r][c] * x[c];
+  }
+  double ssTot = sumVV - sumV * sumV / fit.used;
+  fit.rSquared = ssTot > 0 ? 1 - ssRes / ssTot : 0;
+  return fit;
+}
@@ -0,0 +1,39 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       gain-schedule.h                                           */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  turnPID gains by turn size and what the robot carries     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include "robot-state.h"
+
+// What the robot is carrying. loadAuto works it out from the mechanisms
+enum turnLoad { loadNone, loadBackGoal, loadLiftHigh, loadCount, loadAuto = -1 };
+
+typedef struct _turnGains {
+  double kP;
+  double kI;
+  double kD;
+} turnGains;
+
+// Off until every row of the table is measured on the robot, turnGainsFor
+// then gives the plain kP/kI/kD for every turn
+extern bool gainScheduleEnabled;
+
+// Lift above this (degrees, see liftHeight) counts as high, back drawing more than this
+// (amps) is holding a goal
+extern double liftHighPosition;
+extern double backGoalCurrent;
+
+// Load from the latest sensor sample. Lift high wins over a back goal,
+// it moves the center of mass more
+turnLoad turnLoadFromState(const robotState &state);
+
+// Gains for a turn of this many degrees (either way) with this load,
+// interpolated between the table rows. Scales kP/kI/kD from main.cpp
+// when gainScheduleEnabled
+turnGains turnGainsFor(double turnSize, turnLoad load);
+
@@ -0,0 +1,36 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       input-log.h                                               */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Record driver inputs and replay them as an autonomous     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include "driver-control.h"
+
+// Start/stop recording the driver loop (Controller1 Y, off the field).
+// Safe from a button callback: it only asks, the driver loop starts or
+// stops between frames in inputLogRecord. Stopping hands the recording to
+// the ui task to write to replay.bin
+void inputLogToggle(void);
+bool inputLogRecording(void);
+
+// Add one driver pass to the recording, if recording. Starts and stops
+// asked for by inputLogToggle happen here
+void inputLogRecord(const driverInput &input);
+
+// Write a finished recording to the SD card, called from the ui task
+void inputLogService(void);
+
+// Read replay.bin into memory, true if a recording is ready to replay
+bool inputLogLoad(void);
+
+// Msec the loaded recording plays for (frames * period), 0 when none is
+uint32_t inputLogLength(void);
+
+// Feed the loaded recording through applyDriverInput at its recorded rate,
+// correcting the chassis toward the recorded drive encoder positions.
+// Stops after timeout msec, false when that cut the recording short
+bool inputLogReplay(uint32_t timeout);
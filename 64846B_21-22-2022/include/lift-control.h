@@ -0,0 +1,49 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       lift-control.h                                            */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Synchronized LiftA/LiftB control                          */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include "vex.h"
+
+// How the two lift motors are driven
+//    - liftGroup:  plain motor_group, each motor runs its own loop (old way)
+//    - liftSynced: equal effort on both sides plus a correction on the
+//                  position difference so one side can't run ahead
+enum liftMode { liftGroup, liftSynced };
+
+// Mode used by every lift command below. Defaults to liftSynced
+extern liftMode liftSyncMode;
+
+// Degrees of position difference -> percent of velocity correction
+extern double liftSyncKP;
+
+// Start the background lift task. Call once from pre_auton
+void liftInit(void);
+
+// Driver control: spin both sides at velocity (percent) or hold in place
+void liftSpin(directionType dir, double velocity);
+void liftStop(void);
+
+// Same arguments as motor_group::spinFor so autonomous calls read the same.
+// Waiting gives up after timeout msec (0 picks one from the distance and
+// speed), stops the lift and returns false
+bool liftSpinFor(directionType dir, double rotation, rotationUnits units,
+                 double velocity, velocityUnits unitsV,
+                 bool waitForCompletion = true, uint32_t timeout = 0);
+bool liftIsDone(void);
+
+// The lift goes up when it runs in reverse, so a raised lift has a negative
+// position. Degrees above where it started from a Lift position
+inline double liftHeight(double position) { return -position; }
+
+// LiftA - LiftB in degrees, positive when the A side is ahead
+double liftSyncError(void);
+
+// Run cycles up/down moves of travel degrees with the plain group and
+// then synced, and print cycle time and current for each
+void liftBenchmark(int cycles, double travel);
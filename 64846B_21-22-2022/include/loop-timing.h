@@ -0,0 +1,83 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       loop-timing.h                                             */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Loop timing histograms and the diagnostics page           */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include "vex.h"
+
+// Bucket i holds times in [2^(i-1), 2^i) usec, bucket 0 is under 1 usec
+// and the last bucket is everything from 2^(timingBuckets-2) usec up
+const int timingBuckets = 16;
+
+// Timing for one named section of code. Declare as a global, it adds itself
+// to the diagnostics page unless listed is false. Only one task should
+// record into a section.
+class timingSection {
+public:
+  timingSection(const char *name, uint32_t budget, bool listed = true);
+
+  void record(uint32_t usec) {
+    count += 1;
+    total += usec;
+    if (usec > max)
+      max = usec;
+    if (usec > budget)
+      overruns += 1;
+
+    int bucket = usec == 0 ? 0 : 32 - __builtin_clz(usec);
+    if (bucket >= timingBuckets)
+      bucket = timingBuckets - 1;
+    histogram[bucket] += 1;
+  }
+
+  void reset(void);
+
+  const char *name;
+  // Anything longer than this (usec) counts as an overrun
+  uint32_t budget;
+  uint32_t count;
+  uint64_t total;
+  uint32_t max;
+  uint32_t overruns;
+  uint32_t histogram[timingBuckets];
+};
+
+// Times from construction to destruction (or stop) into a section
+class scopedTimer {
+public:
+  scopedTimer(timingSection &section)
+      : section(section), start(timer::systemHighResolution()),
+        running(true) {}
+
+  ~scopedTimer() { stop(); }
+
+  void stop(void) {
+    if (running) {
+      section.record((uint32_t)(timer::systemHighResolution() - start));
+      running = false;
+    }
+  }
+
+private:
+  timingSection &section;
+  uint64_t start;
+  bool running;
+};
+
+// Sections timed across the program
+extern timingSection turnPIDTiming;
+extern timingSection driveToTiming;
+extern timingSection userControlTiming;
+extern timingSection buttonDrawTiming;
+extern timingSection sensorTiming;
+
+// Measure what a probe costs and add the diagnostics page
+void timingInit(void);
+
+// Clear every section
+void timingReset(void);
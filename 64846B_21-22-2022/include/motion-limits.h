@@ -0,0 +1,48 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       motion-limits.h                                           */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Speed and acceleration limits for planning routines       */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+// No vex.h, used by the host tools. Speeds are at 100%, steps scale them
+// by their velocity.
+//
+// None of these are measured yet. The speeds and settle times are
+// estimates and the accels are linearMaxAccel/angularMaxAccel from
+// feedforward.cpp. To measure them:
+//    - drive: FF linear test, 12 V / kV for the speed (less kS)
+//    - turn: FF angular test the same way, and turnPID's scope trace for
+//      the settle time
+//    - mechanisms: Lift bench, degrees over msec at 100%
+//    - settle: the timing report's actual minus this estimate
+// then run make check and copy the new estimates into auton-routines.h
+
+// Drive, in/s and in/s^2 (accel matches linearMaxAccel)
+const double driveMaxVelocity = 42;
+const double driveMaxAccel = 60;
+// driveTo runs on a profile capped by driveMaxVolts, a bit slower
+const double driveToMaxVelocity = 30;
+
+// turnPID, deg/s at maxSpeed and deg/s^2 (accel matches angularMaxAccel)
+const double turnMaxVelocity = 240;
+const double turnMaxAccel = 360;
+
+// 36:1 mechanisms (back, claw, lift) and an 18:1 drive side, motor deg/s
+const double mechanismMaxVelocity = 600;
+const double mechanismMaxAccel = 3000;
+const double sideMaxVelocity = 1200;
+const double sideMaxAccel = 6000;
+
+// Time to settle after the motion itself, seconds
+const double driveSettle = 0.1;
+const double driveToSettle = 0.3;
+const double turnSettle = 0.25;
+const double mechanismSettle = 0.05;
+
+// squareToWall: the last inch or so at 4 V, then its 300 msec grace and
+// 200 msec of both sides blocked
+const double squareTime = 0.8;
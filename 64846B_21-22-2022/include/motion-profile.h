@@ -0,0 +1,79 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       motion-profile.h                                          */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Trapezoidal motion profile (no vex code, host usable)     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include <math.h>
+
+typedef struct _profilePoint {
+  double position;
+  double velocity;
+  double acceleration;
+} profilePoint;
+
+// Move distance (>= 0) from rest to rest, accelerating at maxAccel up to
+// maxVelocity. Short moves never reach maxVelocity and become a triangle.
+// Nothing to move (distance <= 0) is a zero length profile that sits at 0.
+class trapezoidProfile {
+public:
+  trapezoidProfile(double distance, double maxVelocity, double maxAccel)
+      : distance(distance), accel(maxAccel) {
+    if (distance <= 0 || maxVelocity <= 0 || maxAccel <= 0) {
+      this->distance = 0;
+      accel = 0;
+      cruiseVelocity = 0;
+      rampTime = 0;
+      cruiseTime = 0;
+      return;
+    }
+    // Peak velocity if we accelerate for half the distance
+    double peak = sqrt(distance * maxAccel);
+    cruiseVelocity = peak < maxVelocity ? peak : maxVelocity;
+    rampTime = cruiseVelocity / accel;
+    double rampDistance = cruiseVelocity * rampTime / 2;
+    cruiseTime = (distance - 2 * rampDistance) / cruiseVelocity;
+    if (cruiseTime < 0)
+      cruiseTime = 0;
+  }
+
+  double duration(void) const { return 2 * rampTime + cruiseTime; }
+
+  profilePoint sample(double t) const {
+    profilePoint point;
+    if (t <= 0) {
+      point.position = 0;
+      point.velocity = 0;
+      point.acceleration = accel;
+    } else if (t < rampTime) {
+      point.position = accel * t * t / 2;
+      point.velocity = accel * t;
+      point.acceleration = accel;
+    } else if (t < rampTime + cruiseTime) {
+      point.position = cruiseVelocity * rampTime / 2 + cruiseVelocity * (t - rampTime);
+      point.velocity = cruiseVelocity;
+      point.acceleration = 0;
+    } else if (t < duration()) {
+      double left = duration() - t;
+      point.position = distance - accel * left * left / 2;
+      point.velocity = accel * left;
+      point.acceleration = -accel;
+    } else {
+      point.position = distance;
+      point.velocity = 0;
+      point.acceleration = 0;
+    }
+    return point;
+  }
+
+private:
+  double distance;
+  double accel;
+  double cruiseVelocity;
+  double rampTime;
+  double cruiseTime;
+};
@@ -0,0 +1,39 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       motor-health.h                                            */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Motor temperature/current monitor and hold derating       */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include "vex.h"
+
+// Motors start limiting current at 55C. Warn before that, and start
+// derating idle holds before the warning
+extern double healthWarnTemp;
+extern double healthDerateTemp;
+
+// Start the monitor task and add the Motors page
+void healthInit(void);
+
+// Mechanism helpers for the driver loop
+//    - healthHoldTorque: about to hold still, lower the torque if the
+//                        motor is hot (never below its floor)
+//    - healthFullTorque: about to move, full torque again
+void healthHoldTorque(motor &m);
+void healthFullTorque(motor &m);
+
+// Full torque on everything, autonomous doesn't go through the helpers
+void healthFullTorqueAll(void);
+
+// Newest warning for the controller screen ("" if none), count goes up
+// whenever it changes
+typedef struct _healthMessage {
+  int count;
+  char text[32];
+} healthMessage;
+
+// Copy of the newest warning, never half written
+void healthWarningRead(healthMessage &message);
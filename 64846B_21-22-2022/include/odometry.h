@@ -0,0 +1,20 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       odometry.h                                                */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Pose from the drive encoders and inertial heading         */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include "robot-state.h"
+
+// Called by the sensor task with the encoders and rotation already read,
+// fills in state.x and state.y
+void odometryUpdate(robotState &state);
+
+// Move one axis of the pose, takes effect on the next sample. Anything
+// can call these, the sensor task applies them
+void odometrySetX(double x);
+void odometrySetY(double y);
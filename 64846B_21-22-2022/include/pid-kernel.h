@@ -0,0 +1,69 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       pid-kernel.h                                              */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  PID step shared by turnPID and driveTo                    */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+// No vex.h, templated on the scalar so it can run in float (single
+// precision is what the V5's FPU does fast) or double
+
+// Scalar the control loops use
+typedef float controlScalar;
+
+template <typename T> struct pidGains {
+  T kP;
+  T kI;
+  T kD;
+  // The integral only builds when |error| is under this, reset otherwise
+  T integralZone;
+  // Output is capped to +-limit, 0 for no cap
+  T limit;
+};
+
+template <typename T> struct pidMemory {
+  T prevError;
+  T integral;
+  T derivative;
+};
+
+// fabs() from math.h takes a double, this stays in T
+template <typename T> inline T pidAbs(T x) { return x < 0 ? -x : x; }
+
+template <typename T> inline void pidReset(pidMemory<T> &memory) {
+  memory.prevError = 0;
+  memory.integral = 0;
+  memory.derivative = 0;
+}
+
+// One iteration: error in, output (plus feedforward, before the cap) out
+template <typename T>
+inline T pidStep(const pidGains<T> &gains, pidMemory<T> &memory, T error,
+                 T feedforward) {
+  memory.derivative = error - memory.prevError;
+  memory.prevError = error;
+
+  // Checking if error passes threshold to build the integral
+  if (pidAbs(error) < gains.integralZone && error != 0)
+    memory.integral += error;
+  else
+    memory.integral = 0;
+
+  T output = error * gains.kP + memory.derivative * gains.kD +
+             memory.integral * gains.kI + feedforward;
+
+  if (gains.limit > 0) {
+    if (output > gains.limit)
+      output = gains.limit;
+    else if (output < -gains.limit)
+      output = -gains.limit;
+  }
+  return output;
+}
+
+// Time pidStep in double and in float on the brain and show the cost of
+// an iteration in usec and CPU cycles (Tests page)
+void pidBenchmark(void);
@@ -0,0 +1,24 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       pid-scope.h                                               */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Live setpoint/measurement/output plot on the Brain screen */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include "vex.h"
+
+// Control loops call these, they only copy into a lock-free ring
+//    - scopeStart: a new move begins from start toward target, in the units
+//                  of setpoint/measurement (rescales and restarts the sweep)
+//    - scopePush:  one loop iteration, output in volts
+void scopeStart(double start, double target);
+void scopePush(double setpoint, double measurement, double output);
+
+// Add the Scope page
+void scopeInit(void);
+
+// Drain the ring and plot it if the page is up, called from the ui task
+void scopeUpdate(void);
@@ -10,9 +10,14 @@ extern motor FrontLeft;
 extern motor BackLeft;
 extern motor FrontRight;
 extern motor BackRight;
+extern motor LiftA;
+extern motor LiftB;
 extern motor_group Lift;
 extern controller Controller2;
 extern inertial TurnGyroSmart;
+extern motor_group LeftDriveSmart;
+extern motor_group RightDriveSmart;
+extern smartdrive Drivetrain;
 
 /**
  * Used to initialize code/tasks/devices added using tools in VEXcode Pro.
@@ -0,0 +1,121 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       robot-state.h                                             */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Robot state snapshot shared between tasks                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include <atomic>
+
+#include "vex.h"
+
+// Seqlock around one value. A single writer bumps the sequence to odd,
+// copies the value in and bumps it back to even. Readers copy the value and
+// retry if the sequence was odd or changed underneath them, so the writer
+// never waits on a reader and a reader never keeps a half written copy.
+template <typename T> class seqlock {
+public:
+  seqlock() : sequence(0), data() {}
+
+  void write(const T &value) {
+    uint32_t seq = sequence.load(std::memory_order_relaxed);
+    sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    data = value;
+    sequence.store(seq + 2, std::memory_order_release);
+  }
+
+  void read(T &value) const {
+    uint32_t before, after;
+    while (true) {
+      before = sequence.load(std::memory_order_acquire);
+      value = data;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      after = sequence.load(std::memory_order_relaxed);
+      if (before == after && (before & 1) == 0)
+        return;
+      // writer is mid copy, let it finish
+      this_thread::yield();
+    }
+  }
+
+private:
+  std::atomic<uint32_t> sequence;
+  T data;
+};
+
+// Everything the control and UI code reads from the sensors, sampled
+// together by the sensor task
+typedef struct _robotState {
+  // Counts up once per sample
+  uint32_t sample;
+  // Brain time of the sample in msec
+  uint32_t time;
+
+  // Inertial, in degrees
+  double rotation;
+  double heading;
+
+  // Drive encoders in degrees (front motor of each side)
+  double leftPosition;
+  double rightPosition;
+  // Drive side velocity in percent
+  double leftVelocity;
+  double rightVelocity;
+  // Drive side current in amps (both motors of the side)
+  double leftCurrent;
+  double rightCurrent;
+
+  // Odometry pose in inches: x to the right and y forward of where the
+  // robot started (or was last relocalized), see odometry.cpp
+  double x;
+  double y;
+
+  // Inertial acceleration in g
+  double accelX;
+  double accelY;
+
+  // Traction, see traction.cpp: chassis velocity from the inertial (in/s),
+  // each side's encoder velocity minus it (in/s), the torque each side is
+  // allowed (percent) and slip events since power on
+  double imuVelocity;
+  double leftSlip;
+  double rightSlip;
+  double leftTorque;
+  double rightTorque;
+  uint32_t slipCount;
+
+  // Mechanisms in degrees
+  double liftPosition;
+  double clawPosition;
+  double backPosition;
+  // Back current in amps, it draws more holding a goal
+  double backCurrent;
+
+  // Battery in volts
+  double batteryVoltage;
+} robotState;
+
+// Result of the last turnPID/driveTo for the tuning screen
+typedef struct _moveReport {
+  // Counts up once per move, 0 means nothing reported yet
+  int count;
+  // Turn # for turnPID, 0 for driveTo
+  int turnCount;
+  double iter;
+  double error;
+  double derivative;
+} moveReport;
+
+// Called by the sensor task only
+void robotStatePublish(const robotState &state);
+// Latest full sample, never blocks the sensor task
+void robotStateRead(robotState &state);
+// Wait for a sample started after this call (use after resetting encoders)
+void robotStateReadFresh(robotState &state);
+
+void moveReportPublish(const moveReport &report);
+void moveReportRead(moveReport &report);
@@ -0,0 +1,33 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       runtime.h                                                 */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Background tasks, their priorities and rates              */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include "vex.h"
+
+// Task priorities (higher runs first, the default task priority is 7)
+//    - sensor:  samples every device and publishes the robotState
+//    - control: autonomous/usercontrol and the lift task
+//    - ui:      Brain/controller screens and logging, gets what is left
+const int32_t sensorPriority = 12;
+const int32_t controlPriority = 10;
+const int32_t uiPriority = 3;
+
+// Task periods in msec
+const uint32_t sensorPeriod = 10;
+const uint32_t uiPeriod = 100;
+
+// Start the sensor and ui tasks. Call once from pre_auton
+void runtimeInit(void);
+
+// Call at the top of autonomous/usercontrol to run them at control priority
+void runtimeControlThread(void);
+
+// Fixed rate loops: sleep until period msec after next and advance next.
+// A pass that ran over restarts the schedule from now instead of bursting
+void runtimeSleepUntil(uint32_t &next, uint32_t period);
@@ -0,0 +1,57 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       spsc-ring.h                                               */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Lock-free single producer / single consumer ring          */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+
+// One task pushes, one other task pops, neither ever waits. When the ring
+// is full the producer's item is dropped, so a slow consumer can never hold
+// up a control loop. N has to be a power of 2.
+template <typename T, uint32_t N> class spscRing {
+  static_assert((N & (N - 1)) == 0, "spscRing size must be a power of 2");
+
+public:
+  spscRing() : dropped(0), head(0), tail(0) {}
+
+  // Producer side
+  bool push(const T &item) {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) >= N) {
+      dropped += 1;
+      return false;
+    }
+    items[h & (N - 1)] = item;
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side
+  bool pop(T &item) {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire))
+      return false;
+    item = items[t & (N - 1)];
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  uint32_t size(void) const {
+    return head.load(std::memory_order_acquire) -
+           tail.load(std::memory_order_acquire);
+  }
+
+  // Items the producer had to throw away, only written by the producer
+  uint32_t dropped;
+
+private:
+  std::atomic<uint32_t> head;
+  std::atomic<uint32_t> tail;
+  T items[N];
+};
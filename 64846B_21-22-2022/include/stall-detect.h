@@ -0,0 +1,38 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       stall-detect.h                                            */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Stall/collision detection for drive moves                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include "robot-state.h"
+
+// How a drive move ended
+enum moveResult { moveDone, moveStalled, moveTimeout };
+
+typedef struct _stallDetector {
+  // When the move started, msec
+  uint32_t start;
+  // When the drive first looked blocked, 0 when it doesn't
+  uint32_t blockedSince;
+  // Hit something hard since blockedSince
+  bool collision;
+} stallDetector;
+
+void stallStart(stallDetector &detector);
+
+// True once the drive has been blocked for the stall window: drawing
+// current while moving much slower than commanded (percent of full speed),
+// or right after a hard stop seen on the inertial sensor
+bool stallCheck(stallDetector &detector, const robotState &state,
+                double commanded);
+
+// Drivetrain.driveFor that gives up when blocked or out of time instead of
+// pushing until the distance is reached. timeout 0 picks one from the
+// distance and speed
+moveResult driveChecked(directionType dir, double distance,
+                        distanceUnits units, double velocity,
+                        velocityUnits unitsV, uint32_t timeout = 0);
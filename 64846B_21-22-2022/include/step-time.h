@@ -0,0 +1,63 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       step-time.h                                               */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  How long a step takes, from motion-limits.h               */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include <math.h>
+
+#include "auton-steps.h"
+#include "motion-limits.h"
+#include "motion-profile.h"
+
+// No vex.h, the one timing model for the host tools: auton-time plans
+// with it and auton-sim runs with it. A step's expected msec is this
+// rounded to 50, and make check fails when a table drifts from it
+
+// Seconds for a trapezoid profile over distance
+inline double stepProfileTime(double distance, double velocity, double accel) {
+  return trapezoidProfile(distance, velocity, accel).duration();
+}
+
+// Seconds the motion takes, settle included. heading is the rotation
+// turnPID is at before the step and is moved on by turns and squares.
+// Replay depends on the recording, 0
+inline double stepMotionTime(const autonStep &step, double &heading) {
+  double scale = step.velocity / 100;
+  switch (step.kind) {
+  case stepDrive:
+  case stepDriveRetry:
+    return stepProfileTime(fabs(step.amount), driveMaxVelocity * scale,
+                           driveMaxAccel) + driveSettle;
+  case stepDriveTo:
+    return stepProfileTime(fabs(step.amount) * 12, driveToMaxVelocity,
+                           driveMaxAccel) + driveToSettle;
+  case stepTurn: {
+    double t = stepProfileTime(fabs(step.amount - heading), turnMaxVelocity,
+                               turnMaxAccel) + turnSettle;
+    heading = step.amount;
+    return t;
+  }
+  case stepRightSide:
+    return stepProfileTime(fabs(step.amount), sideMaxVelocity * scale,
+                           sideMaxAccel) + mechanismSettle;
+  case stepBack:
+  case stepClaw:
+  case stepLift:
+    return stepProfileTime(fabs(step.amount), mechanismMaxVelocity * scale,
+                           mechanismMaxAccel) + mechanismSettle;
+  case stepWait:
+    return step.amount / 1000;
+  case stepReplay:
+    return 0;
+  case stepSquare:
+    // Rotation is reset to the wall's
+    heading = step.amount;
+    return squareTime;
+  }
+  return 0;
+}
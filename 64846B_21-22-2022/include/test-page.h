@@ -0,0 +1,21 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       test-page.h                                               */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Brain screen page that runs tests/benchmarks on the robot */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include "vex.h"
+
+// Add a test button. Tests move the robot, so they are only queued from the
+// page and are run by the driver loop (see testPoll)
+void testAdd(const char *name, void (*run)(void));
+
+// Add the Tests page
+void testInit(void);
+
+// Run a queued test. Call from the driver loop, only when not on a field
+void testPoll(void);
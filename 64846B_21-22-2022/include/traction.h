@@ -0,0 +1,41 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       traction.h                                                */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Wheel slip from the encoders against the inertial         */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include "robot-state.h"
+
+// The sensor task integrates the inertial's forward acceleration into a
+// chassis velocity and compares it with each drive side's encoder velocity
+// (plus that side's share of the turn). A side running off from the
+// chassis by more than tractionSlip is slipping and has its torque cut
+// until it grips again.
+//    - tractionSlip:       in/s between a side and the chassis
+//    - tractionMinTorque:  percent, lowest a side gets cut to
+//    - tractionEnabled:    false leaves the estimate running but never cuts
+extern double tractionSlip;
+extern double tractionMinTorque;
+extern bool tractionEnabled;
+
+// Called by the sensor task after odometryUpdate, fills in the slip and
+// torque fields of state
+void tractionUpdate(robotState &state);
+
+// Set the drive sides to the torque in state, only when it changed. Call
+// from whichever loop is driving (driver control, drive moves)
+void tractionApply(const robotState &state);
+
+// Both sides back to full torque, at the end of a drive move
+void tractionRelease(void);
+
+// Start a new stats period (e.g. when a match phase is enabled)
+void tractionStatsReset(void);
+
+// Print the slip events for the period and append them to traction.csv
+// on the SD card if one is inserted
+void tractionStatsLog(const char *period);
@@ -0,0 +1,32 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       wall-square.h                                             */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Square against a wall and relocalize from it              */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+#include "vex.h"
+
+// Pose axis a wall pins down
+enum poseAxis { axisNone, axisX, axisY };
+
+typedef struct _squareResult {
+  // Both sides ended up against the wall, nothing is reset otherwise
+  bool squared;
+  // Degrees added to the rotation, inches added to the pose axis
+  double headingCorrection;
+  double poseCorrection;
+} squareResult;
+
+// Push into a wall or platform edge at low power until both sides stall,
+// so the robot turns itself flat against it. Then
+//    - rotation is set to wallRotation (the whole turn of it nearest the
+//      current rotation), so turnPID targets stay absolute
+//    - the pose axis, if given, is set to axisValue
+// and the corrections are printed and returned
+squareResult squareToWall(directionType dir, double wallRotation,
+                          poseAxis axis = axisNone, double axisValue = 0,
+                          uint32_t timeout = 3000);
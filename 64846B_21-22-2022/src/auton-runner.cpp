@@ -0,0 +1,402 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       auton-runner.cpp                                          */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Runs step tables against the match clock                  */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <atomic>
+
+#include "auton-runner.h"
+#include "drive-geometry.h"
+#include "gain-schedule.h"
+#include "input-log.h"
+#include "lift-control.h"
+#include "stall-detect.h"
+#include "wall-square.h"
+
+// From main.cpp
+void turnPID(double angleTurn, turnLoad load, uint32_t timeout);
+moveResult driveTo(double targetDistance, uint32_t timeout);
+
+uint32_t autonMinStep = stepMinTime;
+
+// Longest a replay gets the clock for, a skills run
+const uint32_t replayMaxLength = 60000;
+
+uint32_t matchStart = 0;
+uint32_t matchEnd = 0;
+
+// How a step went
+enum stepStatus { stepRan, stepShortened, stepTimedOut, stepStalled, stepSkipped };
+
+const char *statusNames[] = {"ran", "shortened", "timed out", "stalled",
+                             "skipped"};
+
+typedef struct _stepRecord {
+  const char *routine;
+  int step;
+  stepKind kind;
+  stepStatus status;
+  // msec since the match started, planned and taken
+  uint32_t start;
+  uint32_t planned;
+  uint32_t actual;
+  // Wheel slip events during the step
+  uint32_t slips;
+} stepRecord;
+
+const int maxRecords = 128;
+stepRecord records[maxRecords];
+std::atomic<int> recordCount(0);
+
+static int32_t timeLeft(void) { return (int32_t)(matchEnd - timer::system()); }
+
+static void record(const autonRoutine &routine, int index, stepStatus status,
+                   uint32_t start, uint32_t actual, uint32_t slips) {
+  int count = recordCount;
+  if (count >= maxRecords)
+    return;
+
+  const autonStep &step = routine.steps[index];
+  stepRecord r = {routine.name, index, step.kind, status,
+                  start - matchStart, step.expected, actual, slips};
+  records[count] = r;
+  recordCount = count + 1;
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Steps, each one stops by timeout msec */
+/*-----------------------------------------------------------------------------*/
+
+static directionType sign(double amount) { return amount >= 0 ? forward : reverse; }
+
+// Non-blocking spinFor, then wait for it or the timeout
+static moveResult mechanism(motor &m, const autonStep &step, uint32_t timeout) {
+  m.spinFor(sign(step.amount), fabs(step.amount), degrees, step.velocity,
+            velocityUnits::pct, false);
+  if (!step.wait)
+    return moveDone;
+
+  uint32_t start = timer::system();
+  do {
+    this_thread::sleep_for(10);
+    if (timer::system() - start > timeout) {
+      m.stop(brakeType::hold);
+      return moveTimeout;
+    }
+  } while (!m.isDone());
+  return moveDone;
+}
+
+static moveResult lift(const autonStep &step, uint32_t timeout) {
+  bool done = liftSpinFor(sign(step.amount), fabs(step.amount), degrees,
+                          step.velocity, velocityUnits::pct, step.wait, timeout);
+  return done ? moveDone : moveTimeout;
+}
+
+static moveResult rightSide(const autonStep &step, uint32_t timeout) {
+  RightDriveSmart.spinFor(sign(step.amount), fabs(step.amount), degrees,
+                          step.velocity, velocityUnits::pct, false);
+  if (!step.wait)
+    return moveDone;
+
+  uint32_t start = timer::system();
+  do {
+    this_thread::sleep_for(10);
+    if (timer::system() - start > timeout) {
+      RightDriveSmart.stop(brake);
+      return moveTimeout;
+    }
+  } while (!RightDriveSmart.isDone());
+  return moveDone;
+}
+
+static moveResult drive(const autonStep &step, uint32_t timeout) {
+  if (!step.wait) {
+    Drivetrain.driveFor(sign(step.amount),
+                        fabs(step.amount) * geometryDriveScale(), inches,
+                        step.velocity, velocityUnits::pct, false);
+    return moveDone;
+  }
+
+  moveResult result = driveChecked(sign(step.amount), fabs(step.amount),
+                                   inches, step.velocity, velocityUnits::pct,
+                                   timeout);
+
+  // Caught on the platform stand, back off and try once more
+  if (step.kind == stepDriveRetry && result == moveStalled) {
+    directionType back = step.amount >= 0 ? reverse : forward;
+    driveChecked(back, 2, inches, step.velocity, velocityUnits::pct);
+    result = driveChecked(sign(step.amount), 2, inches, step.velocity,
+                          velocityUnits::pct);
+  }
+  return result;
+}
+
+// Always waits, there's nothing to reset from until it's flat
+static moveResult square(const autonStep &step, uint32_t timeout) {
+  poseAxis axis = step.axis == stepAxisX
+                      ? axisX
+                      : (step.axis == stepAxisY ? axisY : axisNone);
+  squareResult result = squareToWall(sign(step.velocity), step.amount, axis,
+                                     step.axisValue, timeout);
+  return result.squared ? moveDone : moveTimeout;
+}
+
+static moveResult runStep(const autonStep &step, uint32_t timeout) {
+  switch (step.kind) {
+  case stepDrive:
+  case stepDriveRetry:
+    return drive(step, timeout);
+  case stepDriveTo:
+    return driveTo(step.amount, timeout);
+  case stepTurn:
+    turnPID(step.amount, loadAuto, timeout);
+    return moveDone;
+  case stepRightSide:
+    return rightSide(step, timeout);
+  case stepBack:
+    return mechanism(Back, step, timeout);
+  case stepClaw:
+    return mechanism(Claw, step, timeout);
+  case stepLift:
+    return lift(step, timeout);
+  case stepWait:
+    this_thread::sleep_for(step.amount < timeout ? (uint32_t)step.amount : timeout);
+    return moveDone;
+  case stepReplay:
+    return inputLogReplay(timeout) ? moveDone : moveTimeout;
+  case stepSquare:
+    return square(step, timeout);
+  }
+  return moveDone;
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Stage the selected routines while disabled */
+/*-----------------------------------------------------------------------------*/
+
+// One step laid out in run order
+typedef struct _stagedStep {
+  const autonRoutine *routine;
+  int index;
+  // Expected msec of the required steps after this one, in any routine
+  uint32_t requiredAfter;
+} stagedStep;
+
+const int maxStaged = 128;
+stagedStep staged[maxStaged];
+int stagedCount = 0;
+uint32_t stagedLength = 0;
+// When staging started, autonomous() after this ran warm
+uint32_t stagedAt = 0;
+bool stagedReady = false;
+std::atomic<int> stagedSelection(-1);
+char stagedStatus[64] = "Nothing staged";
+// Staging from the idle loop and from autonomous() don't overlap
+mutex stageLock;
+
+std::atomic<int32_t> startLatency(-1);
+std::atomic<bool> startWarm(false);
+
+typedef struct _stageDevice {
+  const char *name;
+  device *dev;
+} stageDevice;
+
+stageDevice stageDevices[] = {
+    {"FrontLeft", &FrontLeft}, {"BackLeft", &BackLeft},
+    {"FrontRight", &FrontRight}, {"BackRight", &BackRight},
+    {"LiftA", &LiftA},         {"LiftB", &LiftB},
+    {"Claw", &Claw},           {"Back", &Back},
+    {"Gyro", &TurnGyroSmart}};
+
+// First thing wrong with the robot for these routines, NULL when ready
+static const char *stageProblem(bool replay) {
+  for (int i = 0; i < sizeof(stageDevices) / sizeof(stageDevice); i++)
+    if (!stageDevices[i].dev->installed())
+      return stageDevices[i].name;
+  if (TurnGyroSmart.isCalibrating())
+    return "gyro calibrating";
+  // Loaded now so the replay doesn't read the SD card on the clock
+  if (replay && !inputLogLoad())
+    return "no replay.bin";
+  return NULL;
+}
+
+void autonPrepare(const autonRoutine *const *routines, int count,
+                  int selection) {
+  stageLock.lock();
+  stagedAt = timer::system();
+
+  // Set stopping functions for the rest of the code
+  Drivetrain.setStopping(brake);
+  Claw.setStopping(brakeType::hold);
+  Back.setStopping(brakeType::hold);
+
+  // Lay the steps out in order, the required time after each is summed
+  // backwards so it spans all the routines
+  int n = 0;
+  bool replay = false;
+  uint32_t expected = 0;
+  stagedLength = 0;
+  for (int r = 0; r < count; r++) {
+    const autonRoutine &routine = *routines[r];
+    if (routine.matchLength > stagedLength)
+      stagedLength = routine.matchLength;
+    for (int i = 0; i < routine.count && n < maxStaged; i++, n++) {
+      staged[n].routine = &routine;
+      staged[n].index = i;
+      expected += routine.steps[i].expected;
+      if (routine.steps[i].kind == stepReplay)
+        replay = true;
+    }
+  }
+  stagedCount = n;
+
+  uint32_t required = 0;
+  for (int i = n - 1; i >= 0; i--) {
+    staged[i].requiredAfter = required;
+    const autonStep &step = staged[i].routine->steps[staged[i].index];
+    if (step.priority == stepRequired)
+      required += step.expected;
+  }
+
+  const char *problem = stageProblem(replay);
+  stagedReady = problem == NULL;
+
+  // A replay runs as long as it was recorded, up to a skills run, so a
+  // 60 s recording isn't cut off at the 15 s the routine table gives it
+  if (replay && stagedReady) {
+    uint32_t recorded = inputLogLength();
+    if (recorded > replayMaxLength)
+      recorded = replayMaxLength;
+    if (recorded > stagedLength)
+      stagedLength = recorded;
+  }
+  if (count == 0)
+    snprintf(stagedStatus, sizeof(stagedStatus), "Nothing selected");
+  else if (problem != NULL)
+    snprintf(stagedStatus, sizeof(stagedStatus), "Check %s", problem);
+  else
+    snprintf(stagedStatus, sizeof(stagedStatus), "Ready %s%s: %d steps %.1fs",
+             routines[0]->name, count > 1 ? " +" : "", n, expected / 1000.0);
+
+  stagedSelection = selection;
+  stageLock.unlock();
+}
+
+// Anything wrong is checked again, the gyro may have finished calibrating
+// or the cable gone back in
+bool autonPrepared(int selection) {
+  return stagedSelection == selection && stagedReady;
+}
+
+const char *autonPrepareStatus(void) { return stagedStatus; }
+
+int32_t autonStartLatency(bool &warm) {
+  warm = startWarm;
+  return startLatency;
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Run the staged steps against the clock */
+/*-----------------------------------------------------------------------------*/
+
+void autonRunPrepared(uint32_t entry) {
+  matchStart = entry;
+  matchEnd = entry + (stagedLength > 0 ? stagedLength : 15000);
+  recordCount = 0;
+  bool warm = (int32_t)(entry - stagedAt) > 0;
+  bool first = true;
+
+  for (int i = 0; i < stagedCount; i++) {
+    const autonRoutine &routine = *staged[i].routine;
+    const autonStep &step = routine.steps[staged[i].index];
+    uint32_t start = timer::system();
+    int32_t left = timeLeft();
+
+    if (stepSkip(step, staged[i].requiredAfter, left, autonMinStep)) {
+      printf("auton %s step %d (%s): skipped, %ld ms left\n", routine.name,
+             staged[i].index, stepKindNames[step.kind], (long)left);
+      record(routine, staged[i].index, stepSkipped, start, 0, 0);
+      continue;
+    }
+
+    if (first) {
+      first = false;
+      startLatency = (int32_t)(start - entry);
+      startWarm = warm;
+      printf("auton: first step %lu ms after start (%s)\n",
+             (unsigned long)(start - entry), warm ? "warm" : "cold");
+    }
+
+    uint32_t timeout = stepTimeout(step, left);
+    bool limited = timeout < step.expected * 2 + 500;
+
+    robotState before;
+    robotStateRead(before);
+    moveResult result = runStep(step, timeout);
+    uint32_t actual = timer::system() - start;
+    robotState after;
+    robotStateRead(after);
+
+    stepStatus status = stepRan;
+    if (result == moveStalled)
+      status = stepStalled;
+    else if (result == moveTimeout || (step.wait && actual >= timeout))
+      status = limited ? stepShortened : stepTimedOut;
+    record(routine, staged[i].index, status, start, actual,
+           after.slipCount - before.slipCount);
+  }
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Planned against actual for the last autonomous */
+/*-----------------------------------------------------------------------------*/
+
+void autonReportLog(void) {
+  int count = recordCount;
+  if (count == 0)
+    return;
+
+  bool sd = Brain.SDcard.isInserted();
+  if (sd && !Brain.SDcard.exists("auton-timing.csv"))
+    Brain.SDcard.savefile(
+        "auton-timing.csv",
+        (uint8_t *)"routine,step,kind,status,start,planned,actual,slips\n", 52);
+
+  uint32_t planned = 0;
+  uint32_t actual = 0;
+  int skipped = 0;
+  uint32_t slips = 0;
+  char line[96];
+  for (int i = 0; i < count; i++) {
+    const stepRecord &r = records[i];
+    planned += r.planned;
+    actual += r.actual;
+    if (r.status == stepSkipped)
+      skipped += 1;
+    slips += r.slips;
+
+    printf("%-12s %3d %-11s %-9s at %5lu planned %5lu actual %5lu slips %lu\n",
+           r.routine, r.step, stepKindNames[r.kind], statusNames[r.status],
+           (unsigned long)r.start, (unsigned long)r.planned,
+           (unsigned long)r.actual, (unsigned long)r.slips);
+    if (sd) {
+      int length = snprintf(line, sizeof(line), "%s,%d,%s,%s,%lu,%lu,%lu,%lu\n",
+                            r.routine, r.step, stepKindNames[r.kind],
+                            statusNames[r.status], (unsigned long)r.start,
+                            (unsigned long)r.planned, (unsigned long)r.actual,
+                            (unsigned long)r.slips);
+      Brain.SDcard.appendfile("auton-timing.csv", (uint8_t *)line, length);
+    }
+  }
+  printf("auton: %d steps, %d skipped, planned %lu ms, took %lu ms, %lu slips\n",
+         count, skipped, (unsigned long)planned, (unsigned long)actual,
+         (unsigned long)slips);
+  recordCount = 0;
+}
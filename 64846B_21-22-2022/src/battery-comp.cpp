@@ -0,0 +1,129 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       battery-comp.cpp                                          */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Battery voltage compensation for voltage-mode commands    */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <atomic>
+
+#include "battery-comp.h"
+#include "robot-state.h"
+
+double batteryNominal = 12.8;
+
+// Low pass on the battery voltage. At the 10 msec sensor rate 0.05 is about a
+// 200 msec time constant: fast enough to follow sag under load, slow enough
+// to not chase noise
+double batteryFilterGain = 0.05;
+
+// Never scale further than this either way, a bad reading shouldn't double
+// the drive power
+const double minScale = 0.8;
+const double maxScale = 1.3;
+
+// Written by the sensor task, read by the control tasks
+std::atomic<float> batteryFiltered(12.8f);
+std::atomic<float> batteryScale(1.0f);
+
+typedef struct _batteryStats {
+  uint32_t samples;
+  uint32_t startTime;
+  uint32_t startCapacity;
+  uint32_t capacity;
+  double minVolts;
+  double maxVolts;
+  double sumVolts;
+  double peakCurrent;
+  double sumCurrent;
+  double maxScaleUsed;
+} batteryStats;
+
+batteryStats stats;
+seqlock<batteryStats> sharedStats;
+std::atomic<bool> statsResetRequested(true);
+
+double batteryCompensate(double volts) {
+  double scaled = volts * batteryScale.load(std::memory_order_relaxed);
+  if (scaled > 12)
+    return 12;
+  if (scaled < -12)
+    return -12;
+  return scaled;
+}
+
+double batteryVoltageFiltered(void) { return batteryFiltered; }
+
+double batteryUpdate(void) {
+  double volts = Brain.Battery.voltage(volt);
+  double current = Brain.Battery.current(amp);
+
+  // Ignore a dropped reading rather than feeding it to the filter
+  if (volts > 5) {
+    double filtered = batteryFiltered + (volts - batteryFiltered) * batteryFilterGain;
+    double scale = batteryNominal / filtered;
+    if (scale < minScale)
+      scale = minScale;
+    if (scale > maxScale)
+      scale = maxScale;
+    batteryFiltered = filtered;
+    batteryScale = scale;
+  }
+
+  if (statsResetRequested.exchange(false)) {
+    stats.samples = 0;
+    stats.startTime = timer::system();
+    stats.startCapacity = Brain.Battery.capacity();
+    stats.minVolts = 100;
+    stats.maxVolts = 0;
+    stats.sumVolts = 0;
+    stats.peakCurrent = 0;
+    stats.sumCurrent = 0;
+    stats.maxScaleUsed = 0;
+  }
+
+  // Same guard as the filter, a dropped reading would pull the average down
+  if (volts > 5) {
+    stats.samples += 1;
+    stats.sumVolts += volts;
+    stats.sumCurrent += current;
+    if (volts < stats.minVolts)
+      stats.minVolts = volts;
+    if (volts > stats.maxVolts)
+      stats.maxVolts = volts;
+    if (current > stats.peakCurrent)
+      stats.peakCurrent = current;
+    if (batteryScale > stats.maxScaleUsed)
+      stats.maxScaleUsed = batteryScale;
+    // Capacity only changes slowly, once a second is plenty
+    if (stats.samples % 100 == 1)
+      stats.capacity = Brain.Battery.capacity();
+  }
+
+  sharedStats.write(stats);
+  return volts;
+}
+
+void batteryStatsReset(void) { statsResetRequested = true; }
+
+void batteryStatsLog(const char *period) {
+  batteryStats s;
+  sharedStats.read(s);
+  if (s.samples == 0)
+    return;
+
+  char line[160];
+  int length = snprintf(line, sizeof(line),
+      "%s,%lu,%.2f,%.2f,%.2f,%.2f,%.2f,%.3f,%lu,%lu\n", period,
+      (unsigned long)(timer::system() - s.startTime) / 1000, s.minVolts,
+      s.sumVolts / s.samples, s.maxVolts, s.sumCurrent / s.samples,
+      s.peakCurrent, s.maxScaleUsed, (unsigned long)s.startCapacity,
+      (unsigned long)s.capacity);
+
+  // period,seconds,min V,avg V,max V,avg A,peak A,max scale,start %,end %
+  printf("battery: %s", line);
+  if (Brain.SDcard.isInserted())
+    Brain.SDcard.appendfile("battery.csv", (uint8_t *)line, length);
+}
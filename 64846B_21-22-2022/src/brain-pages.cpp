@@ -0,0 +1,91 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       brain-pages.cpp                                           */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Pages on the Brain screen, switched from a tab strip      */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <atomic>
+
+#include "brain-pages.h"
+
+const int maxPages = 8;
+
+brainPage pages[maxPages];
+int pageCount = 0;
+
+// Page on screen, and the page last drawn (-1 forces a full redraw)
+std::atomic<int> currentPage(0);
+int drawnPage = -1;
+
+int pageAdd(const brainPage &page) {
+  if (pageCount >= maxPages)
+    return -1;
+  pages[pageCount] = page;
+  return pageCount++;
+}
+
+int pageCurrent(void) { return currentPage; }
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Tab strip across the top, current page highlighted */
+/*-----------------------------------------------------------------------------*/
+
+static void drawTabs(void) {
+  int width = 480 / (pageCount > 0 ? pageCount : 1);
+
+  Brain.Screen.setFont(fontType::mono15);
+  for (int i = 0; i < pageCount; i++) {
+    vex::color c = i == currentPage ? vex::color(0x2060c0) : vex::color(0x202020);
+    Brain.Screen.setPenColor(vex::color(0xe0e0e0));
+    Brain.Screen.setFillColor(c);
+    Brain.Screen.drawRectangle(i * width, 0, width, pageTabHeight);
+    Brain.Screen.printAt(i * width + 6, 17, pages[i].name);
+  }
+}
+
+void pageDraw(void) {
+  int page = currentPage;
+  if (page >= pageCount)
+    return;
+
+  bool full = page != drawnPage;
+  if (full)
+    Brain.Screen.clearScreen();
+
+  pages[page].draw(full);
+  drawnPage = page;
+
+  // Pages draw from the top, so put the tabs back over them
+  if (full)
+    drawTabs();
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Screen (un)touched, tab strip switches page on release */
+/*-----------------------------------------------------------------------------*/
+
+static void pageTouch(bool pressed) {
+  int xpos = Brain.Screen.xPosition();
+  int ypos = Brain.Screen.yPosition();
+
+  if (ypos < pageTabHeight) {
+    if (!pressed && pageCount > 0)
+      currentPage = (currentPage + 1) % pageCount;
+    return;
+  }
+
+  int page = currentPage;
+  if (page < pageCount && pages[page].touch != NULL)
+    pages[page].touch(xpos, ypos, pressed);
+}
+
+static void pagePressed(void) { pageTouch(true); }
+static void pageReleased(void) { pageTouch(false); }
+
+void pageInit(void) {
+  Brain.Screen.pressed(pagePressed);
+  Brain.Screen.released(pageReleased);
+}
@@ -0,0 +1,252 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       config-store.cpp                                          */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Tuning values saved to the SD card, edited on the Brain   */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <atomic>
+
+#include "config-store.h"
+#include "brain-pages.h"
+
+// Tuning globals from main.cpp
+extern double kP, kI, kD, maxSpeed, turnTolerance;
+extern int turnThreshold, maxIter;
+extern double dkP, dkI, dkD, driveThreshold, driveMaxVolts;
+
+const uint32_t configMagic = 0x31474643; // "CFG1"
+const uint16_t configVersion = 1;
+const char *configFile = "config.bin";
+
+// One tunable. Exactly one of real/whole is set
+typedef struct _configEntry {
+  const char *name;
+  double *real;
+  int *whole;
+  // Page +/- step and limits
+  double step;
+  double min;
+  double max;
+} configEntry;
+
+// Append only, the position is the slot in config.bin
+configEntry entries[] = {
+    {"kP", &kP, NULL, 0.005, 0, 2},
+    {"kI", &kI, NULL, 0.001, 0, 1},
+    {"kD", &kD, NULL, 0.001, 0, 2},
+    {"maxSpeed", &maxSpeed, NULL, 0.5, 1, 12},
+    {"turnTolerance", &turnTolerance, NULL, 0.1, 0.1, 5},
+    {"turnThreshold", NULL, &turnThreshold, 1, 0, 90},
+    {"maxIter", NULL, &maxIter, 25, 50, 2000},
+    {"dkP", &dkP, NULL, 0.005, 0, 2},
+    {"dkI", &dkI, NULL, 0.005, 0, 1},
+    {"dkD", &dkD, NULL, 0.005, 0, 2},
+    {"driveThreshold", &driveThreshold, NULL, 1, 0, 50},
+    {"driveMaxVolts", &driveMaxVolts, NULL, 0.5, 1, 12}};
+
+const int entryCount = sizeof(entries) / sizeof(configEntry);
+
+float defaults[entryCount];
+
+// Same layout as the file
+typedef struct _configImage {
+  configHeader header;
+  float values[entryCount];
+} configImage;
+
+static float entryGet(const configEntry &entry) {
+  return entry.real != NULL ? (float)*entry.real : (float)*entry.whole;
+}
+
+static void entrySet(const configEntry &entry, double value) {
+  if (value < entry.min)
+    value = entry.min;
+  if (value > entry.max)
+    value = entry.max;
+  if (entry.real != NULL)
+    *entry.real = value;
+  else
+    *entry.whole = (int)(value + (value < 0 ? -0.5 : 0.5));
+}
+
+// Standard CRC-32 (same as zip), bit at a time, the file is tiny
+static uint32_t crc32(const uint8_t *data, int length) {
+  uint32_t crc = 0xffffffff;
+  for (int i = 0; i < length; i++) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; bit++)
+      crc = (crc >> 1) ^ (0xedb88320 & -(crc & 1));
+  }
+  return ~crc;
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Load and save */
+/*-----------------------------------------------------------------------------*/
+
+static bool configLoad(void) {
+  if (!Brain.SDcard.isInserted() || !Brain.SDcard.exists(configFile))
+    return false;
+
+  configImage image;
+  int length = Brain.SDcard.loadfile(configFile, (uint8_t *)&image, sizeof(image));
+  if (length < (int)sizeof(configHeader))
+    return false;
+
+  const configHeader &header = image.header;
+  int count = header.count < entryCount ? header.count : entryCount;
+  int valuesLength = header.count * sizeof(float);
+  if (header.magic != configMagic || header.version != configVersion ||
+      length < (int)sizeof(configHeader) + count * (int)sizeof(float)) {
+    printf("config: %s doesn't match, using defaults\n", configFile);
+    return false;
+  }
+  // A newer file with more values than we know about can't be checked
+  if (header.count > entryCount ||
+      crc32((const uint8_t *)image.values, valuesLength) != header.crc) {
+    printf("config: %s failed its check, using defaults\n", configFile);
+    return false;
+  }
+
+  for (int i = 0; i < count; i++)
+    entrySet(entries[i], image.values[i]);
+  printf("config: loaded %d values\n", count);
+  return true;
+}
+
+bool configSave(void) {
+  if (!Brain.SDcard.isInserted())
+    return false;
+
+  configImage image;
+  for (int i = 0; i < entryCount; i++)
+    image.values[i] = entryGet(entries[i]);
+  image.header.magic = configMagic;
+  image.header.version = configVersion;
+  image.header.count = entryCount;
+  image.header.crc = crc32((const uint8_t *)image.values, sizeof(image.values));
+
+  return Brain.SDcard.savefile(configFile, (uint8_t *)&image, sizeof(image)) ==
+         (int)sizeof(image);
+}
+
+void configDefaults(void) {
+  for (int i = 0; i < entryCount; i++)
+    entrySet(entries[i], defaults[i]);
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Config page: pick a row, +/- it, save */
+/*-----------------------------------------------------------------------------*/
+
+// The rows and the status line under them have to end above y=240, 13
+// entries at most
+const int configRow = 15;
+const int configTop = pageTabHeight + 6;
+const int buttonX = 340;
+const int buttonWidth = 130;
+const int buttonHeight = 40;
+
+typedef struct _configButton {
+  const char *label;
+  int y;
+} configButton;
+
+const configButton configButtons[] = {
+    {"+", configTop}, {"-", configTop + 48}, {"Save", configTop + 110},
+    {"Defaults", configTop + 158}};
+
+int selected = 0;
+// Message under the list, set by the buttons
+const char *configStatus = "";
+std::atomic<bool> configDirty(true);
+
+static void drawConfig(bool full) {
+  if (!full && !configDirty)
+    return;
+  configDirty = false;
+
+  Brain.Screen.setFont(fontType::mono15);
+  for (int i = 0; i < entryCount; i++) {
+    const configEntry &entry = entries[i];
+    bool changed = entryGet(entry) != defaults[i];
+    vex::color background = i == selected ? vex::color(0x2060c0) : vex::color::black;
+    int y = configTop + i * configRow;
+    Brain.Screen.setPenColor(background);
+    Brain.Screen.setFillColor(background);
+    Brain.Screen.drawRectangle(0, y, buttonX - 4, configRow);
+    Brain.Screen.setPenColor(changed ? vex::color(0xe0c000) : vex::color(0xe0e0e0));
+    if (entry.real != NULL)
+      Brain.Screen.printAt(4, y + 13, "%-15s %10.4f", entry.name, *entry.real);
+    else
+      Brain.Screen.printAt(4, y + 13, "%-15s %10d", entry.name, *entry.whole);
+  }
+
+  int statusY = configTop + entryCount * configRow;
+  Brain.Screen.setPenColor(vex::color::black);
+  Brain.Screen.setFillColor(vex::color::black);
+  Brain.Screen.drawRectangle(0, statusY, buttonX - 4, configRow + 4);
+  Brain.Screen.setPenColor(vex::color(0x808080));
+  Brain.Screen.printAt(4, statusY + 14, configStatus);
+
+  if (full) {
+    Brain.Screen.setFont(fontType::mono20);
+    for (unsigned i = 0; i < sizeof(configButtons) / sizeof(configButton); i++) {
+      Brain.Screen.setPenColor(vex::color(0xe0e0e0));
+      Brain.Screen.setFillColor(vex::color(0x303030));
+      Brain.Screen.drawRectangle(buttonX, configButtons[i].y, buttonWidth, buttonHeight);
+      Brain.Screen.printAt(buttonX + 10, configButtons[i].y + 28, configButtons[i].label);
+    }
+  }
+}
+
+static void touchConfig(int xpos, int ypos, bool pressed) {
+  if (!pressed)
+    return;
+
+  if (xpos < buttonX) {
+    int row = (ypos - configTop) / configRow;
+    if (row >= 0 && row < entryCount)
+      selected = row;
+    configStatus = "";
+    configDirty = true;
+    return;
+  }
+
+  int button = -1;
+  for (unsigned i = 0; i < sizeof(configButtons) / sizeof(configButton); i++)
+    if (ypos >= configButtons[i].y && ypos < configButtons[i].y + buttonHeight)
+      button = i;
+
+  const configEntry &entry = entries[selected];
+  switch (button) {
+  case 0:
+    entrySet(entry, entryGet(entry) + entry.step);
+    configStatus = "";
+    break;
+  case 1:
+    entrySet(entry, entryGet(entry) - entry.step);
+    configStatus = "";
+    break;
+  case 2:
+    configStatus = configSave() ? "saved to config.bin" : "no SD card, not saved";
+    break;
+  case 3:
+    configDefaults();
+    configStatus = "defaults (not saved)";
+    break;
+  }
+  configDirty = true;
+}
+
+void configInit(void) {
+  for (int i = 0; i < entryCount; i++)
+    defaults[i] = entryGet(entries[i]);
+  configLoad();
+
+  brainPage page = {"Config", drawConfig, touchConfig};
+  pageAdd(page);
+}
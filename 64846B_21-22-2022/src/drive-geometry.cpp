@@ -0,0 +1,164 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       drive-geometry.cpp                                        */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Measured wheel travel and track width                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "drive-geometry.h"
+#include "robot-state.h"
+#include "stall-detect.h"
+
+
+driveGeometry geometry = configuredGeometry;
+
+double calibrationDistance = 48;
+
+// Test settings
+double travelVelocity = 25;   // percent, slow enough not to bounce off
+double spinVolts = 4;
+double spinTurns = 3;
+
+void geometryLoad(void) {
+  if (!Brain.SDcard.isInserted() || !Brain.SDcard.exists("geometry.txt"))
+    return;
+
+  char text[96];
+  int length = Brain.SDcard.loadfile("geometry.txt", (uint8_t *)text,
+                                     sizeof(text) - 1);
+  if (length <= 0)
+    return;
+  text[length] = 0;
+
+  driveGeometry loaded;
+  if (sscanf(text, "travel %lf track %lf", &loaded.wheelTravel,
+             &loaded.trackWidth) == 2 &&
+      loaded.wheelTravel > 0 && loaded.trackWidth > 0)
+    geometry = loaded;
+}
+
+static void geometrySave(void) {
+  char text[96];
+  int length = snprintf(text, sizeof(text), "travel %.4f\ntrack %.4f\n",
+                        geometry.wheelTravel, geometry.trackWidth);
+  if (Brain.SDcard.isInserted())
+    Brain.SDcard.savefile("geometry.txt", (uint8_t *)text, length);
+}
+
+// Measurements more than 20% off the configured value are a bad run
+static bool plausible(double measured, double configured) {
+  return measured > configured * 0.8 && measured < configured * 1.2;
+}
+
+static void showStart(const char *what) {
+  Brain.Screen.clearScreen();
+  Brain.Screen.setFont(fontType::mono20);
+  Brain.Screen.setCursor(2, 1);
+  Brain.Screen.print("Calibrating %s...", what);
+}
+
+static void showResult(const char *what, double measured, double configured) {
+  Brain.Screen.newLine();
+  Brain.Screen.print("%s %.3f in (was %.3f)", what, measured, configured);
+  printf("geometry: %s %.4f in, was %.4f\n", what, measured, configured);
+  if (!plausible(measured, configured)) {
+    Brain.Screen.newLine();
+    Brain.Screen.print("Out of range, not saved");
+  }
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Wheel travel, drive into a wall from a known distance */
+/*-----------------------------------------------------------------------------*/
+
+void calibrateWheelTravel(void) {
+  showStart("wheel travel");
+
+  robotState state;
+  robotStateRead(state);
+  double startLeft = state.leftPosition;
+  double startRight = state.rightPosition;
+
+  stallDetector detector;
+  stallStart(detector);
+  LeftDriveSmart.spin(forward, travelVelocity, velocityUnits::pct);
+  RightDriveSmart.spin(forward, travelVelocity, velocityUnits::pct);
+
+  // Stops at the wall, or gives up at twice the distance
+  bool reached = false;
+  while (timer::system() - detector.start < 10000) {
+    this_thread::sleep_for(10);
+    robotStateRead(state);
+    if (stallCheck(detector, state, travelVelocity)) {
+      reached = true;
+      break;
+    }
+  }
+  LeftDriveSmart.stop(brake);
+  RightDriveSmart.stop(brake);
+
+  // The stall window pushed against the wall without moving, so the
+  // encoders read the distance to it
+  double degrees = (fabs(state.leftPosition - startLeft) +
+                    fabs(state.rightPosition - startRight)) / 2;
+  if (!reached || degrees < 90) {
+    Brain.Screen.newLine();
+    Brain.Screen.print("Never reached the wall");
+    return;
+  }
+
+  double travel = calibrationDistance / (degrees / 360);
+  showResult("travel", travel, geometry.wheelTravel);
+  if (plausible(travel, configuredGeometry.wheelTravel)) {
+    geometry.wheelTravel = travel;
+    geometrySave();
+  }
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Track width, spin in place */
+/*-----------------------------------------------------------------------------*/
+
+void calibrateTrackWidth(void) {
+  showStart("track width");
+
+  robotState state;
+  robotStateRead(state);
+  double startLeft = state.leftPosition;
+  double startRight = state.rightPosition;
+  double startRotation = state.rotation;
+
+  LeftDriveSmart.spin(forward, spinVolts, voltageUnits::volt);
+  RightDriveSmart.spin(forward, -spinVolts, voltageUnits::volt);
+  uint32_t start = timer::system();
+  while (fabs(state.rotation - startRotation) < spinTurns * 360 &&
+         timer::system() - start < 15000) {
+    this_thread::sleep_for(10);
+    robotStateRead(state);
+  }
+  LeftDriveSmart.stop(brake);
+  RightDriveSmart.stop(brake);
+
+  // Let it coast to a stop, the encoders and the gyro both count that
+  wait(500, msec);
+  robotStateRead(state);
+
+  // Each side drives an arc of track/2 * angle
+  double arc = geometryInches((fabs(state.leftPosition - startLeft) +
+                               fabs(state.rightPosition - startRight)) / 2);
+  double radians = fabs(state.rotation - startRotation) * 3.14159265358979 / 180;
+  if (radians < 1) {
+    Brain.Screen.newLine();
+    Brain.Screen.print("Didn't turn");
+    return;
+  }
+
+  double track = 2 * arc / radians;
+  showResult("track", track, geometry.trackWidth);
+  if (plausible(track, configuredGeometry.trackWidth)) {
+    geometry.trackWidth = track;
+    geometrySave();
+  }
+}
@@ -0,0 +1,172 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       driver-control.cpp                                        */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Driver inputs and what they do to the robot               */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <atomic>
+
+#include "driver-control.h"
+#include "lift-control.h"
+#include "motor-health.h"
+
+// toggled from controller button events, read by the driver loop
+std::atomic<bool> halfspeed(false);
+std::atomic<bool> soloControl(false);
+void solo() {soloControl = !soloControl;}
+
+void halfspeedcontrol() { halfspeed = !halfspeed; }
+
+std::atomic<bool> headingAssist(true);
+void assistToggle() { headingAssist = !headingAssist; }
+
+// Stick deadband in percent
+int threshold = 20;
+
+// Heading hold
+//    - sticks within assistMatch (percent) of each other is driving straight
+//    - assistKP percent per degree off the held heading, up to assistMax
+int assistMatch = 10;
+double assistKP = 1.5;
+double assistMax = 15;
+
+// Only the driver loop touches these
+bool holdingHeading = false;
+double heldRotation = 0;
+
+void driverControlInit(void) {
+  Controller1.ButtonA.pressed(halfspeedcontrol);
+  Controller1.ButtonB.pressed(solo);
+  Controller1.ButtonX.pressed(assistToggle);
+  holdingHeading = false;
+}
+
+static uint16_t readButtons(controller &c) {
+  uint16_t buttons = 0;
+  if (c.ButtonL1.pressing()) buttons |= buttonL1;
+  if (c.ButtonL2.pressing()) buttons |= buttonL2;
+  if (c.ButtonR1.pressing()) buttons |= buttonR1;
+  if (c.ButtonR2.pressing()) buttons |= buttonR2;
+  if (c.ButtonUp.pressing()) buttons |= buttonUp;
+  if (c.ButtonDown.pressing()) buttons |= buttonDown;
+  if (c.ButtonLeft.pressing()) buttons |= buttonLeft;
+  if (c.ButtonRight.pressing()) buttons |= buttonRight;
+  if (c.ButtonX.pressing()) buttons |= buttonX;
+  if (c.ButtonB.pressing()) buttons |= buttonB;
+  if (c.ButtonY.pressing()) buttons |= buttonY;
+  if (c.ButtonA.pressing()) buttons |= buttonA;
+  return buttons;
+}
+
+void readDriverInput(driverInput &input) {
+  input.left = Controller1.Axis3.position(percentUnits::pct);
+  input.right = Controller1.Axis2.position(percentUnits::pct);
+  input.buttons1 = readButtons(Controller1);
+  input.buttons2 = readButtons(Controller2);
+  input.halfspeed = halfspeed;
+  input.soloControl = soloControl;
+}
+
+// One side of the tank drive
+static void driveSide(motor_group &side, int stick, bool half,
+                      double correction) {
+  int speed = abs(stick) > threshold ? stick : 0;
+
+  if (speed == 0 && correction == 0) {
+    side.stop(brakeType::brake);
+    return;
+  }
+
+  // halfspeed control
+  double velocity = half ? speed * .50 : speed;
+  side.spin(directionType::fwd, velocity + correction, percentUnits::pct);
+}
+
+void applyDriverInput(const driverInput &input, double leftCorrection,
+                      double rightCorrection) {
+  // Tank Drivetrain //
+  driveSide(LeftDriveSmart, input.left, input.halfspeed, leftCorrection);
+  driveSide(RightDriveSmart, input.right, input.halfspeed, rightCorrection);
+
+  // Solo puts every mechanism on Controller1, otherwise claw and lift are
+  // on Controller2
+  bool clawFwd, clawRev, liftFwd, liftRev;
+  if (input.soloControl) {
+    clawFwd = input.buttons1 & buttonL2;
+    clawRev = input.buttons1 & buttonR2;
+    liftFwd = input.buttons1 & buttonDown;
+    liftRev = input.buttons1 & buttonUp;
+  } else {
+    clawFwd = input.buttons2 & buttonR1;
+    clawRev = input.buttons2 & buttonR2;
+    liftFwd = input.buttons2 & buttonL2;
+    liftRev = input.buttons2 & buttonL1;
+  }
+
+  // Claw Controls //
+
+  if (clawFwd || clawRev) {
+    healthFullTorque(Claw);
+    Claw.spin(clawFwd ? directionType::fwd : directionType::rev, 100,
+              velocityUnits::pct);
+  } else {
+    healthHoldTorque(Claw);
+    Claw.stop(brakeType::hold);
+  }
+
+  // Lift Controls //
+
+  if (liftFwd || liftRev) {
+    healthFullTorque(LiftA);
+    healthFullTorque(LiftB);
+    liftSpin(liftFwd ? directionType::fwd : directionType::rev, 100);
+  } else {
+    healthHoldTorque(LiftA);
+    healthHoldTorque(LiftB);
+    liftStop();
+  }
+
+  // Back Controls (Controller1 in both modes) //
+
+  if (input.buttons1 & (buttonL1 | buttonR1)) {
+    healthFullTorque(Back);
+    Back.spin(input.buttons1 & buttonL1 ? directionType::fwd : directionType::rev,
+              100, velocityUnits::pct);
+  } else {
+    healthHoldTorque(Back);
+    Back.stop(brakeType::hold);
+  }
+}
+
+void headingHold(const driverInput &input, const robotState &state,
+                 double &leftCorrection, double &rightCorrection) {
+  leftCorrection = 0;
+  rightCorrection = 0;
+
+  bool moving = abs(input.left) > threshold && abs(input.right) > threshold;
+  bool sameWay = (input.left > 0) == (input.right > 0);
+  bool straight = moving && sameWay && abs(input.left - input.right) <= assistMatch;
+  if (!headingAssist || !straight) {
+    holdingHeading = false;
+    return;
+  }
+
+  // Hold whatever heading the robot had when the sticks came together
+  if (!holdingHeading) {
+    heldRotation = state.rotation;
+    holdingHeading = true;
+  }
+
+  // Off to the left (rotation below held) speeds up the left side, the
+  // same whichever way we're driving
+  double correction = (heldRotation - state.rotation) * assistKP;
+  if (correction > assistMax)
+    correction = assistMax;
+  else if (correction < -assistMax)
+    correction = -assistMax;
+  leftCorrection = correction;
+  rightCorrection = -correction;
+}
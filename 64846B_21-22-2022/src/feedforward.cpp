@@ -0,0 +1,199 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       feedforward.cpp                                           */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Drivetrain feedforward and its characterization tests     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "feedforward.h"
+#include "battery-comp.h"
+#include "drive-geometry.h"
+#include "ff-fit.h"
+
+feedforward linearFF = {0, 0, 0};
+feedforward angularFF = {0, 0, 0};
+
+double linearMaxAccel = 60;
+double angularMaxAccel = 360;
+
+// Test settings
+//    - quasi-static: ramp slowly so acceleration stays ~0, gives kS and kV
+//    - step: jump straight to a voltage, gives kA
+// Linear settings are kept small so the runs fit on the field
+double linearRampRate = 1;    // volts per second
+double linearRampMax = 4;     // volts
+double linearStepVolts = 4;
+double linearStepTime = 1;    // seconds
+double angularRampRate = 0.5;
+double angularRampMax = 6;
+double angularStepVolts = 6;
+double angularStepTime = 1.5;
+
+// Ignore samples slower than this (in/s or deg/s)
+double fitMinVelocity = 0.5;
+
+const int samplePeriod = 10;
+const int maxSamples = 1500;
+ffSample samples[maxSamples];
+int sampleCount = 0;
+
+void feedforwardLoad(void) {
+  if (!Brain.SDcard.isInserted() || !Brain.SDcard.exists("feedforward.txt"))
+    return;
+
+  char text[128];
+  int length = Brain.SDcard.loadfile("feedforward.txt", (uint8_t *)text,
+                                     sizeof(text) - 1);
+  if (length <= 0)
+    return;
+  text[length] = 0;
+
+  feedforward linear, angular;
+  if (sscanf(text, "linear %lf %lf %lf angular %lf %lf %lf", &linear.kS,
+             &linear.kV, &linear.kA, &angular.kS, &angular.kV,
+             &angular.kA) == 6) {
+    linearFF = linear;
+    angularFF = angular;
+  }
+}
+
+static void feedforwardSave(void) {
+  char text[128];
+  int length = snprintf(text, sizeof(text),
+                        "linear %.5f %.5f %.5f\nangular %.5f %.5f %.5f\n",
+                        linearFF.kS, linearFF.kV, linearFF.kA, angularFF.kS,
+                        angularFF.kV, angularFF.kA);
+  if (Brain.SDcard.isInserted())
+    Brain.SDcard.savefile("feedforward.txt", (uint8_t *)text, length);
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Chassis velocity for the test being run */
+/*-----------------------------------------------------------------------------*/
+
+static double linearVelocity(void) {
+  double wheelRpm = (LeftDriveSmart.velocity(velocityUnits::rpm) +
+                     RightDriveSmart.velocity(velocityUnits::rpm)) / 2;
+  return wheelRpm * geometry.wheelTravel / 60;
+}
+
+// From the change in rotation so the sign always matches turnPID
+double lastRotation = 0;
+uint32_t lastRotationTime = 0;
+
+static double angularVelocity(void) {
+  double rotation = TurnGyroSmart.rotation(degrees);
+  uint32_t now = timer::system();
+  double velocity = now > lastRotationTime
+      ? (rotation - lastRotation) * 1000 / (now - lastRotationTime) : 0;
+  lastRotation = rotation;
+  lastRotationTime = now;
+  return velocity;
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Apply volts (turning when angular) and log until time is up */
+/*-----------------------------------------------------------------------------*/
+
+static void runTest(bool angular, double rampRate, double startVolts,
+                    double maxVolts, double duration, double sign) {
+  uint32_t start = timer::system();
+  angularVelocity();
+
+  while (sampleCount < maxSamples) {
+    double t = (timer::system() - start) / 1000.0;
+    if (t > duration)
+      break;
+
+    double volts = startVolts + rampRate * t;
+    if (volts > maxVolts)
+      volts = maxVolts;
+    volts *= sign;
+
+    // Compensated like turnPID/driveTo will send the fitted volts, so the
+    // log (and the fit) is in volts at batteryNominal
+    LeftDriveSmart.spin(forward, batteryCompensate(volts), voltageUnits::volt);
+    RightDriveSmart.spin(forward, batteryCompensate(angular ? -volts : volts),
+                         voltageUnits::volt);
+
+    ffSample sample = {(float)t, (float)volts,
+                       (float)(angular ? angularVelocity() : linearVelocity())};
+    samples[sampleCount++] = sample;
+    this_thread::sleep_for(samplePeriod);
+  }
+
+  LeftDriveSmart.stop(brake);
+  RightDriveSmart.stop(brake);
+  wait(1, sec);
+}
+
+static void saveLog(const char *name) {
+  if (!Brain.SDcard.isInserted())
+    return;
+
+  Brain.SDcard.savefile(name, (uint8_t *)"time,volts,velocity\n", 20);
+  char line[48];
+  for (int i = 0; i < sampleCount; i++) {
+    int length = snprintf(line, sizeof(line), "%.3f,%.3f,%.3f\n",
+                          samples[i].time, samples[i].volts,
+                          samples[i].velocity);
+    Brain.SDcard.appendfile(name, (uint8_t *)line, length);
+  }
+}
+
+static void characterize(bool angular) {
+  sampleCount = 0;
+  Brain.Screen.clearScreen();
+  Brain.Screen.setFont(fontType::mono20);
+  Brain.Screen.setCursor(2, 1);
+  Brain.Screen.print("Characterizing %s...", angular ? "angular" : "linear");
+
+  // Quasi-static forward, then a step back the other way so a linear run
+  // ends near where it started
+  if (angular) {
+    runTest(true, angularRampRate, 0, angularRampMax,
+            angularRampMax / angularRampRate, 1);
+    runTest(true, 0, angularStepVolts, angularStepVolts, angularStepTime, -1);
+  } else {
+    runTest(false, linearRampRate, 0, linearRampMax,
+            linearRampMax / linearRampRate, 1);
+    runTest(false, 0, linearStepVolts, linearStepVolts, linearStepTime, -1);
+  }
+
+  // Each test restarts its clock, shift them so the difference in the
+  // fit never spans two tests
+  for (int i = 1; i < sampleCount; i++)
+    if (samples[i].time < samples[i - 1].time)
+      for (int j = i; j < sampleCount; j++)
+        samples[j].time += samples[i - 1].time + 1;
+
+  saveLog(angular ? "ff-angular.csv" : "ff-linear.csv");
+
+  ffFit fit = ffFitSamples(samples, sampleCount, fitMinVelocity);
+  Brain.Screen.newLine();
+  Brain.Screen.print("kS %.4f kV %.5f kA %.5f", fit.kS, fit.kV, fit.kA);
+  Brain.Screen.newLine();
+  Brain.Screen.print("R^2 %.4f from %d samples", fit.rSquared, fit.used);
+  printf("ff %s: kS %.5f kV %.5f kA %.5f R^2 %.4f n %d\n",
+         angular ? "angular" : "linear", fit.kS, fit.kV, fit.kA,
+         fit.rSquared, fit.used);
+
+  // Don't keep a fit that is obviously wrong
+  if (fit.kV > 0 && fit.rSquared > 0.9) {
+    feedforward result = {fit.kS, fit.kV, fit.kA};
+    if (angular)
+      angularFF = result;
+    else
+      linearFF = result;
+    feedforwardSave();
+  } else {
+    Brain.Screen.newLine();
+    Brain.Screen.print("Poor fit, not saved");
+  }
+}
+
+void characterizeLinear(void) { characterize(false); }
+
+void characterizeAngular(void) { characterize(true); }
@@ -0,0 +1,80 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       gain-schedule.cpp                                         */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  turnPID gains by turn size and what the robot carries     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "gain-schedule.h"
+#include "lift-control.h"
+
+// From main.cpp, the 90 degree empty gains everything is scaled from
+extern double kP;
+extern double kI;
+extern double kD;
+
+bool gainScheduleEnabled = false;
+
+double liftHighPosition = 500;
+double backGoalCurrent = 0.8;
+
+// Multipliers on kP/kI/kD, one row per turn size and load. The only gains
+// tried besides kP/kI/kD are kp=.18 / ki=.008 on small turns (main.cpp),
+// which is the 5 degree row. Everything else is 1.0 until it's measured
+// with the scope page, and the schedule stays off (gainScheduleEnabled)
+// until then
+typedef struct _gainRow {
+  double turnSize;
+  turnGains scale[loadCount];
+} gainRow;
+
+const gainRow schedule[] = {
+    //          none               back goal          lift high
+    {5,   {{1.2, 0.89, 1.0}, {1.0, 1.0, 1.0}, {1.0, 1.0, 1.0}}},
+    {30,  {{1.0, 1.0, 1.0}, {1.0, 1.0, 1.0}, {1.0, 1.0, 1.0}}},
+    {90,  {{1.0, 1.0, 1.0}, {1.0, 1.0, 1.0}, {1.0, 1.0, 1.0}}},
+    {180, {{1.0, 1.0, 1.0}, {1.0, 1.0, 1.0}, {1.0, 1.0, 1.0}}}};
+
+const int scheduleRows = sizeof(schedule) / sizeof(gainRow);
+
+turnLoad turnLoadFromState(const robotState &state) {
+  if (liftHeight(state.liftPosition) > liftHighPosition)
+    return loadLiftHigh;
+  if (state.backCurrent > backGoalCurrent)
+    return loadBackGoal;
+  return loadNone;
+}
+
+turnGains turnGainsFor(double turnSize, turnLoad load) {
+  if (!gainScheduleEnabled) {
+    turnGains gains = {kP, kI, kD};
+    return gains;
+  }
+  if (load < 0 || load >= loadCount)
+    load = loadNone;
+  turnSize = fabs(turnSize);
+
+  // Clamp to the ends of the table, interpolate in between
+  turnGains scale = schedule[scheduleRows - 1].scale[load];
+  if (turnSize <= schedule[0].turnSize) {
+    scale = schedule[0].scale[load];
+  } else {
+    for (int i = 1; i < scheduleRows; i++) {
+      if (turnSize <= schedule[i].turnSize) {
+        const turnGains &lo = schedule[i - 1].scale[load];
+        const turnGains &hi = schedule[i].scale[load];
+        double t = (turnSize - schedule[i - 1].turnSize) /
+                   (schedule[i].turnSize - schedule[i - 1].turnSize);
+        scale.kP = lo.kP + (hi.kP - lo.kP) * t;
+        scale.kI = lo.kI + (hi.kI - lo.kI) * t;
+        scale.kD = lo.kD + (hi.kD - lo.kD) * t;
+        break;
+      }
+    }
+  }
+
+  turnGains gains = {kP * scale.kP, kI * scale.kI, kD * scale.kD};
+  return gains;
+}
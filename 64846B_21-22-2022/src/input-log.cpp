@@ -0,0 +1,296 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       input-log.cpp                                             */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Record driver inputs and replay them as an autonomous     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+// File format (little endian):
+//    header: magic "RPL1", period msec (uint16), unused (uint16),
+//            frame count (uint32), byte count (uint32)
+//    frames: one per driver pass. A mask byte says what changed since the
+//            last frame, then a varint for each set bit in bit order:
+//              bit 0  left stick (zigzag)
+//              bit 1  right stick (zigzag)
+//              bit 2  Controller1 buttons
+//              bit 3  Controller2 buttons
+//              bit 4  toggles (bit 0 halfspeed, bit 1 solo)
+//              bit 5  left drive encoder change in degrees (zigzag)
+//              bit 6  right drive encoder change in degrees (zigzag)
+//            A pass where nothing changed is one byte.
+
+#include <atomic>
+
+#include "input-log.h"
+#include "robot-state.h"
+#include "runtime.h"
+
+const char *replayFile = "replay.bin";
+const uint32_t logMagic = 0x314c5052;
+
+typedef struct _logHeader {
+  uint32_t magic;
+  uint16_t period;
+  uint16_t unused;
+  uint32_t frames;
+  uint32_t bytes;
+} logHeader;
+
+// 60 sec at 50 passes/sec is 3000 frames, most of them a few bytes
+const int logCapacity = 64 * 1024;
+// Largest possible frame
+const int maxFrameBytes = 1 + 7 * 5;
+
+static uint8_t logBuffer[logCapacity];
+static logHeader header = {logMagic, driverPeriod, 0, 0, 0};
+
+std::atomic<bool> recording(false);
+std::atomic<bool> savePending(false);
+// Set by the button callback, handled by the driver loop
+std::atomic<bool> toggleRequested(false);
+std::atomic<bool> replayLoaded(false);
+
+// Last frame written, for the deltas
+static driverInput lastInput;
+static int32_t lastLeft = 0;
+static int32_t lastRight = 0;
+static double startLeft = 0;
+static double startRight = 0;
+
+// Percent of chassis speed per degree behind the recording, and the cap
+double replayKP = 0.5;
+double replayMaxCorrection = 30;
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Varints: 7 bits a byte, high bit set when more follow */
+/*-----------------------------------------------------------------------------*/
+
+static void putVarint(uint32_t value) {
+  while (value >= 0x80) {
+    logBuffer[header.bytes++] = (uint8_t)(value | 0x80);
+    value >>= 7;
+  }
+  logBuffer[header.bytes++] = (uint8_t)value;
+}
+
+static uint32_t getVarint(uint32_t &pos) {
+  uint32_t value = 0;
+  int shift = 0;
+  while (pos < header.bytes) {
+    uint8_t byte = logBuffer[pos++];
+    value |= (uint32_t)(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0)
+      break;
+    shift += 7;
+  }
+  return value;
+}
+
+static uint32_t zigzag(int32_t value) {
+  return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static int32_t unzigzag(uint32_t value) {
+  return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+static uint32_t toggles(const driverInput &input) {
+  return (input.halfspeed ? 1 : 0) | (input.soloControl ? 2 : 0);
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Recording */
+/*-----------------------------------------------------------------------------*/
+
+bool inputLogRecording(void) { return recording; }
+
+void inputLogToggle(void) { toggleRequested = true; }
+
+// Driver loop only, between frames
+static void recordStop(void) {
+  recording = false;
+  savePending = true;
+  Controller1.rumble("--");
+}
+
+static void recordStart(void) {
+  if (savePending)
+    return;
+
+  robotState state;
+  robotStateRead(state);
+  startLeft = state.leftPosition;
+  startRight = state.rightPosition;
+  lastLeft = lastRight = 0;
+  lastInput = driverInput();
+  header.frames = 0;
+  header.bytes = 0;
+  // The buffer is about to be overwritten
+  replayLoaded = false;
+
+  recording = true;
+  Controller1.rumble(".");
+}
+
+void inputLogRecord(const driverInput &input) {
+  if (toggleRequested.exchange(false)) {
+    if (recording) {
+      recordStop();
+      return;
+    }
+    recordStart();
+  }
+  if (!recording)
+    return;
+
+  if (header.bytes + maxFrameBytes > (uint32_t)logCapacity) {
+    // Out of room, keep what we have
+    recordStop();
+    return;
+  }
+
+  robotState state;
+  robotStateRead(state);
+  int32_t left = (int32_t)(state.leftPosition - startLeft);
+  int32_t right = (int32_t)(state.rightPosition - startRight);
+
+  uint8_t mask = 0;
+  if (input.left != lastInput.left) mask |= 1 << 0;
+  if (input.right != lastInput.right) mask |= 1 << 1;
+  if (input.buttons1 != lastInput.buttons1) mask |= 1 << 2;
+  if (input.buttons2 != lastInput.buttons2) mask |= 1 << 3;
+  if (toggles(input) != toggles(lastInput)) mask |= 1 << 4;
+  if (left != lastLeft) mask |= 1 << 5;
+  if (right != lastRight) mask |= 1 << 6;
+
+  logBuffer[header.bytes++] = mask;
+  if (mask & (1 << 0)) putVarint(zigzag(input.left));
+  if (mask & (1 << 1)) putVarint(zigzag(input.right));
+  if (mask & (1 << 2)) putVarint(input.buttons1);
+  if (mask & (1 << 3)) putVarint(input.buttons2);
+  if (mask & (1 << 4)) putVarint(toggles(input));
+  if (mask & (1 << 5)) putVarint(zigzag(left - lastLeft));
+  if (mask & (1 << 6)) putVarint(zigzag(right - lastRight));
+
+  header.frames += 1;
+  lastInput = input;
+  lastLeft = left;
+  lastRight = right;
+}
+
+void inputLogService(void) {
+  if (!savePending)
+    return;
+
+  if (Brain.SDcard.isInserted()) {
+    Brain.SDcard.savefile(replayFile, (uint8_t *)&header, sizeof(header));
+    Brain.SDcard.appendfile(replayFile, logBuffer, header.bytes);
+    printf("replay: saved %lu frames, %lu bytes\n",
+           (unsigned long)header.frames, (unsigned long)header.bytes);
+  }
+  // What was just recorded can be replayed without reading it back
+  replayLoaded = true;
+  savePending = false;
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Replay */
+/*-----------------------------------------------------------------------------*/
+
+bool inputLogLoad(void) {
+  if (replayLoaded)
+    return true;
+  if (recording || savePending || !Brain.SDcard.isInserted() ||
+      !Brain.SDcard.exists(replayFile))
+    return false;
+
+  logHeader loaded;
+  int32_t size = Brain.SDcard.size(replayFile);
+  if (size < (int32_t)sizeof(loaded) ||
+      size > (int32_t)(sizeof(loaded) + logCapacity))
+    return false;
+
+  // Header and frames come back in one read, then split
+  static uint8_t file[sizeof(logHeader) + logCapacity];
+  if (Brain.SDcard.loadfile(replayFile, file, size) != size)
+    return false;
+  memcpy(&loaded, file, sizeof(loaded));
+  if (loaded.magic != logMagic ||
+      loaded.bytes != (uint32_t)size - sizeof(loaded))
+    return false;
+
+  header = loaded;
+  memcpy(logBuffer, file + sizeof(loaded), header.bytes);
+  replayLoaded = true;
+  return true;
+}
+
+uint32_t inputLogLength(void) {
+  if (!replayLoaded)
+    return 0;
+  return header.frames * header.period;
+}
+
+static double clampCorrection(double value) {
+  if (value > replayMaxCorrection)
+    return replayMaxCorrection;
+  if (value < -replayMaxCorrection)
+    return -replayMaxCorrection;
+  return value;
+}
+
+bool inputLogReplay(uint32_t timeout) {
+  if (!inputLogLoad())
+    return true;
+
+  driverInput input = driverInput();
+  int32_t left = 0, right = 0;
+  uint32_t pos = 0;
+  uint32_t late = 0;
+
+  robotState state;
+  robotStateRead(state);
+  double originLeft = state.leftPosition;
+  double originRight = state.rightPosition;
+
+  uint32_t start = timer::system();
+  uint32_t next = start;
+  uint32_t frame = 0;
+  for (; frame < header.frames && pos < header.bytes; frame++) {
+    // The match clock wins over the recording
+    if (timer::system() - start >= timeout)
+      break;
+
+    uint8_t mask = logBuffer[pos++];
+    if (mask & (1 << 0)) input.left = unzigzag(getVarint(pos));
+    if (mask & (1 << 1)) input.right = unzigzag(getVarint(pos));
+    if (mask & (1 << 2)) input.buttons1 = getVarint(pos);
+    if (mask & (1 << 3)) input.buttons2 = getVarint(pos);
+    if (mask & (1 << 4)) {
+      uint32_t bits = getVarint(pos);
+      input.halfspeed = bits & 1;
+      input.soloControl = bits & 2;
+    }
+    if (mask & (1 << 5)) left += unzigzag(getVarint(pos));
+    if (mask & (1 << 6)) right += unzigzag(getVarint(pos));
+
+    // Close the loop on where the drive was when this was recorded
+    robotStateRead(state);
+    double leftError = left - (state.leftPosition - originLeft);
+    double rightError = right - (state.rightPosition - originRight);
+    applyDriverInput(input, clampCorrection(leftError * replayKP),
+                     clampCorrection(rightError * replayKP));
+
+    if (timer::system() > next + header.period)
+      late += 1;
+    runtimeSleepUntil(next, header.period);
+  }
+
+  LeftDriveSmart.stop(brake);
+  RightDriveSmart.stop(brake);
+  printf("replay: %lu of %lu frames, %lu late\n", (unsigned long)frame,
+         (unsigned long)header.frames, (unsigned long)late);
+  return frame >= header.frames;
+}
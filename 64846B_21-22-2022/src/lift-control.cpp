@@ -0,0 +1,273 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       lift-control.cpp                                          */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Synchronized LiftA/LiftB control                          */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <atomic>
+
+#include "lift-control.h"
+#include "robot-state.h"
+#include "runtime.h"
+
+liftMode liftSyncMode = liftSynced;
+
+// Percent of velocity added/removed per degree the sides are apart
+double liftSyncKP = 2.0;
+// Percent of velocity per degree of error left on a spinFor move
+double liftMoveKP = 1.0;
+// Close enough to the target to call a spinFor done (degrees)
+double liftMoveTolerance = 4;
+// Period of the lift task in msec
+int liftPeriod = 10;
+
+// What the lift task is currently doing
+enum liftState { liftHolding, liftVelocity, liftMoving };
+
+// One command, published as a unit. id goes up whenever the state changes
+// or a new move starts, so the task can tell a new command from the one it
+// just finished
+typedef struct _liftRequest {
+  uint32_t id;
+  liftState state;
+  // Signed velocity in percent for liftVelocity, speed cap for liftMoving
+  double velocity;
+  // Target average position in degrees for liftMoving
+  double target;
+} liftRequest;
+
+// Only the commanding task (driver loop or autonomous) writes request
+liftRequest request = {0, liftHolding, 0, 0};
+seqlock<liftRequest> sharedRequest;
+// Last move the lift task finished
+std::atomic<uint32_t> liftFinished(0);
+
+// Logging for the current move, lift task only
+double liftMaxError = 0;
+uint32_t liftMoveStart = 0;
+
+static void liftPublish(liftState state, double velocity, double target) {
+  if (state != request.state || state == liftMoving)
+    request.id += 1;
+  request.state = state;
+  request.velocity = velocity;
+  request.target = target;
+  sharedRequest.write(request);
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Clamp to +-limit */
+/*-----------------------------------------------------------------------------*/
+
+static double liftClamp(double value, double limit) {
+  if (value > limit)
+    return limit;
+  if (value < -limit)
+    return -limit;
+  return value;
+}
+
+double liftSyncError(void) {
+  return LiftA.position(degrees) - LiftB.position(degrees);
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Drive both sides at the same effort, corrected by the difference */
+/*-----------------------------------------------------------------------------*/
+
+static void liftDriveSynced(double velocity, double syncError) {
+  double correction = syncError * liftSyncKP;
+
+  LiftA.spin(forward, liftClamp(velocity - correction, 100), velocityUnits::pct);
+  LiftB.spin(forward, liftClamp(velocity + correction, 100), velocityUnits::pct);
+}
+
+static void liftLogMove(const liftRequest &done) {
+  if (done.state == liftMoving)
+    printf("lift: %.0f deg in %lu ms, max side difference %.1f deg\n",
+           done.target, (unsigned long)(timer::system() - liftMoveStart),
+           liftMaxError);
+  else
+    printf("lift: driver move %lu ms, max side difference %.1f deg\n",
+           (unsigned long)(timer::system() - liftMoveStart), liftMaxError);
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Background task, only does work while synced */
+/*-----------------------------------------------------------------------------*/
+
+// The task is the only thing that drives the motors while synced, so a
+// stop can't be overtaken by a spin from a command it already replaced
+int liftTask() {
+  liftRequest last = {0, liftHolding, 0, 0};
+
+  while (true) {
+    liftRequest now;
+    sharedRequest.read(now);
+
+    if (liftSyncMode == liftSynced) {
+      if (now.id != last.id) {
+        // Log the driver move or the move that was cut short
+        if (last.state == liftVelocity ||
+            (last.state == liftMoving && liftFinished != last.id))
+          liftLogMove(last);
+        liftMaxError = 0;
+        liftMoveStart = timer::system();
+        if (now.state == liftHolding)
+          Lift.stop(hold);
+      }
+
+      bool finished = now.state == liftMoving && liftFinished == now.id;
+      if (now.state != liftHolding && !finished) {
+        double posA = LiftA.position(degrees);
+        double posB = LiftB.position(degrees);
+        double syncError = posA - posB;
+
+        if (fabs(syncError) > liftMaxError)
+          liftMaxError = fabs(syncError);
+
+        if (now.state == liftVelocity) {
+          liftDriveSynced(now.velocity, syncError);
+        } else {
+          // Move the average of both sides to the target
+          double error = now.target - (posA + posB) / 2;
+
+          if (fabs(error) < liftMoveTolerance) {
+            Lift.stop(hold);
+            liftFinished = now.id;
+            liftLogMove(now);
+          } else {
+            liftDriveSynced(liftClamp(error * liftMoveKP, now.velocity),
+                            syncError);
+          }
+        }
+      }
+    }
+    last = now;
+    this_thread::sleep_for(liftPeriod);
+  }
+  return 0;
+}
+
+void liftInit(void) {
+  static task liftControlTask = task(liftTask, controlPriority);
+}
+
+void liftSpin(directionType dir, double velocity) {
+  if (liftSyncMode == liftGroup) {
+    Lift.spin(dir, velocity, velocityUnits::pct);
+    return;
+  }
+  liftPublish(liftVelocity, dir == forward ? velocity : -velocity, 0);
+}
+
+void liftStop(void) {
+  if (liftSyncMode == liftGroup) {
+    Lift.stop(hold);
+    return;
+  }
+  // The lift task stops it, once per change
+  liftPublish(liftHolding, 0, 0);
+}
+
+bool liftSpinFor(directionType dir, double rotation, rotationUnits units,
+                 double velocity, velocityUnits unitsV,
+                 bool waitForCompletion, uint32_t timeout) {
+  // Everything below works in degrees and percent
+  if (units == rotationUnits::rev)
+    rotation *= 360;
+  // 36:1 cartridge, so 100 rpm is already 100% and rpm needs no change
+  if (unitsV == velocityUnits::dps)
+    velocity = velocity / 600 * 100;
+
+  if (liftSyncMode == liftGroup) {
+    Lift.spinFor(dir, rotation, degrees, velocity, velocityUnits::pct, false);
+  } else {
+    double start = (LiftA.position(degrees) + LiftB.position(degrees)) / 2;
+    liftPublish(liftMoving, fabs(velocity),
+                dir == forward ? start + rotation : start - rotation);
+  }
+
+  if (!waitForCompletion)
+    return true;
+
+  // Twice the time at the commanded speed (600 deg/s at 100%), plus 1 s
+  if (timeout == 0)
+    timeout = 1000 + (uint32_t)(2000 * fabs(rotation) /
+                                (600 * fmax(fabs(velocity), 5) / 100));
+
+  uint32_t start = timer::system();
+  while (!liftIsDone()) {
+    if (timer::system() - start > timeout) {
+      printf("lift: timed out after %lu ms\n", (unsigned long)timeout);
+      liftStop();
+      return false;
+    }
+    this_thread::sleep_for(liftPeriod);
+  }
+  return true;
+}
+
+bool liftIsDone(void) {
+  if (liftSyncMode == liftGroup)
+    return Lift.isDone();
+  return request.state != liftMoving || liftFinished == request.id;
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Time and current for cycles of up/down moves in one mode */
+/*-----------------------------------------------------------------------------*/
+
+static void liftBenchmarkMode(liftMode mode, int cycles, double travel) {
+  liftSyncMode = mode;
+
+  uint32_t start = timer::system();
+  double currentSum = 0;
+  double currentPeak = 0;
+  double errorPeak = 0;
+  int samples = 0;
+
+  for (int cycle = 0; cycle < cycles * 2; cycle++) {
+    // Odd moves go back down
+    liftSpinFor(cycle % 2 == 0 ? reverse : forward, travel, degrees, 100,
+                velocityUnits::pct, false);
+    while (!liftIsDone()) {
+      double current = LiftA.current(amp) + LiftB.current(amp);
+      currentSum += current;
+      samples += 1;
+      if (current > currentPeak)
+        currentPeak = current;
+      if (fabs(liftSyncError()) > errorPeak)
+        errorPeak = fabs(liftSyncError());
+      this_thread::sleep_for(liftPeriod);
+    }
+  }
+
+  double cycleTime = (timer::system() - start) / (double)cycles;
+  double currentAvg = samples > 0 ? currentSum / samples : 0;
+
+  printf("lift bench %s: %.0f ms/cycle, avg %.2f A, peak %.2f A, max diff %.1f deg\n",
+         mode == liftGroup ? "group" : "synced", cycleTime, currentAvg,
+         currentPeak, errorPeak);
+  Brain.Screen.newLine();
+  Brain.Screen.print("%s: %.0fms/cyc %.2fA avg %.2fA pk %.1fdeg",
+                     mode == liftGroup ? "group " : "synced", cycleTime,
+                     currentAvg, currentPeak, errorPeak);
+}
+
+void liftBenchmark(int cycles, double travel) {
+  liftMode savedMode = liftSyncMode;
+
+  Brain.Screen.clearScreen();
+  Brain.Screen.setCursor(1, 1);
+  Brain.Screen.print("Lift benchmark: %d cycles of %.0f deg", cycles, travel);
+
+  liftBenchmarkMode(liftGroup, cycles, travel);
+  liftBenchmarkMode(liftSynced, cycles, travel);
+
+  liftSyncMode = savedMode;
+  liftStop();
+}
@@ -0,0 +1,129 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       loop-timing.cpp                                           */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Loop timing histograms and the diagnostics page           */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "loop-timing.h"
+#include "brain-pages.h"
+
+const int maxSections = 12;
+
+timingSection *sections[maxSections];
+int sectionCount = 0;
+
+// Cost of one empty probe in nsec, measured by timingInit
+uint32_t probeCost = 0;
+
+// Budgets are the work per pass, not the loop period
+timingSection turnPIDTiming("turnPID", 1000);
+timingSection driveToTiming("driveTo", 1000);
+timingSection userControlTiming("usercontrol", 2000);
+timingSection buttonDrawTiming("buttonDraw", 20000);
+timingSection sensorTiming("sensors", 2000);
+
+timingSection::timingSection(const char *name, uint32_t budget, bool listed)
+    : name(name), budget(budget) {
+  reset();
+  if (listed && sectionCount < maxSections)
+    sections[sectionCount++] = this;
+}
+
+void timingSection::reset(void) {
+  count = 0;
+  total = 0;
+  max = 0;
+  overruns = 0;
+  for (int i = 0; i < timingBuckets; i++)
+    histogram[i] = 0;
+}
+
+void timingReset(void) {
+  for (int i = 0; i < sectionCount; i++)
+    sections[i]->reset();
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      One row per section: numbers on the left, histogram on the right */
+/*-----------------------------------------------------------------------------*/
+
+const int rowHeight = 22;
+const int histX = 300;
+const int barWidth = 10;
+
+static void drawSection(timingSection &section, int ypos) {
+  uint32_t avg = section.count > 0 ? section.total / section.count : 0;
+
+  Brain.Screen.setPenColor(vex::color(0xe0e0e0));
+  Brain.Screen.setFillColor(vex::color::black);
+  Brain.Screen.printAt(4, ypos + 16, "%-11s %7lu %5lu %6lu %5lu",
+                       section.name, (unsigned long)section.count,
+                       (unsigned long)avg, (unsigned long)section.max,
+                       (unsigned long)section.overruns);
+
+  // Bars scaled to the fullest bucket
+  uint32_t most = 1;
+  for (int i = 0; i < timingBuckets; i++)
+    if (section.histogram[i] > most)
+      most = section.histogram[i];
+
+  for (int i = 0; i < timingBuckets; i++) {
+    int height = section.histogram[i] * (rowHeight - 4) / most;
+    int x = histX + i * barWidth;
+    // Buckets past the budget are drawn red
+    bool over = i > 0 && ((uint32_t)1 << (i - 1)) >= section.budget;
+
+    Brain.Screen.setPenColor(vex::color::black);
+    Brain.Screen.setFillColor(vex::color::black);
+    Brain.Screen.drawRectangle(x, ypos, barWidth - 1, rowHeight - 2);
+    if (height > 0) {
+      vex::color c = over ? vex::color(0xc11f27) : vex::color(0x00b000);
+      Brain.Screen.setPenColor(c);
+      Brain.Screen.setFillColor(c);
+      Brain.Screen.drawRectangle(x, ypos + rowHeight - 2 - height,
+                                 barWidth - 1, height);
+    }
+  }
+}
+
+static void drawDiagnostics(bool full) {
+  Brain.Screen.setFont(fontType::mono12);
+
+  if (full) {
+    int footer = 46 + sectionCount * rowHeight + 14;
+
+    Brain.Screen.setPenColor(vex::color(0x808080));
+    Brain.Screen.setFillColor(vex::color::black);
+    Brain.Screen.printAt(4, 40, "section       count   avg    max  over   (usec)");
+    Brain.Screen.printAt(histX + barWidth, footer, "1us");
+    Brain.Screen.printAt(histX + 11 * barWidth, footer, "1ms");
+    Brain.Screen.printAt(4, footer, "probe %lu ns, touch to clear",
+                         (unsigned long)probeCost);
+  }
+
+  for (int i = 0; i < sectionCount; i++)
+    drawSection(*sections[i], 46 + i * rowHeight);
+}
+
+static void touchDiagnostics(int xpos, int ypos, bool pressed) {
+  if (!pressed)
+    timingReset();
+}
+
+void timingInit(void) {
+  // Time a batch of empty probes to know what instrumenting costs
+  timingSection probe("probe", 0xffffffff, false);
+
+  const int probes = 1000;
+  uint64_t start = timer::systemHighResolution();
+  for (int i = 0; i < probes; i++) {
+    scopedTimer t(probe);
+  }
+  probeCost = (uint32_t)((timer::systemHighResolution() - start) * 1000 / probes);
+
+  brainPage page = {"Timing", drawDiagnostics, touchDiagnostics};
+  pageAdd(page);
+}
@@ -23,14 +23,30 @@
 
 
 #include "vex.h"
+#include "auton-routines.h"
+#include "auton-runner.h"
+#include "battery-comp.h"
+#include "brain-pages.h"
+#include "config-store.h"
+#include "drive-geometry.h"
+#include "driver-control.h"
+#include "feedforward.h"
+#include "gain-schedule.h"
+#include "input-log.h"
+#include "lift-control.h"
+#include "loop-timing.h"
+#include "motion-profile.h"
+#include "motor-health.h"
+#include "pid-kernel.h"
+#include "pid-scope.h"
+#include "robot-state.h"
+#include "runtime.h"
+#include "stall-detect.h"
+#include "test-page.h"
+#include "traction.h"
+#include "wall-square.h"
 using namespace vex;
 
-motor_group LeftDriveSmart = motor_group(FrontLeft, BackLeft);
-
-motor_group RightDriveSmart = motor_group(FrontRight, BackRight);
-
-smartdrive Drivetrain = smartdrive(LeftDriveSmart, RightDriveSmart, TurnGyroSmart, 319.19, 320, 40, mm, 1);
-
 
 //////////////PID Turning////////////////////////////////////////////////////////
 // PID = Porportion, Inegral, Deriviative (Tuning Parameters)
@@ -98,18 +114,30 @@ int maxIter = 700;
  //Keeps track of how many times angleTracker goes over 360
 int modTracker = 0; 
 
+// Number of moves reported to the tuning screen
+int moveCount = 0;
+
+// Hand tuning data to the ui task instead of writing the controller screen
+// from the control loop
+void reportMove(int turn, double iter, double error, double derivative) {
+  moveCount += 1;
+  moveReport report = {moveCount, turn, iter, error, derivative};
+  moveReportPublish(report);
+}
+
 // Turning Function
-void turnPID(double angleTurn) {
+// load picks the gains with the turn size, by default it's worked out from
+// the lift and back (see gain-schedule.cpp). timeout (msec) stops it early
+// when the match clock is short, 0 leaves it to maxIter
+void turnPID(double angleTurn, turnLoad load = loadAuto, uint32_t timeout = 0) {
   //  Distance to target in degrees
-  double error = 0;
-  //  Error degree from the last iteration
-  double prevError = 0;
-  // Derivative of the error. The slope between iterations
-  double derivative = 0;
-  // Accumulated error after threashold. Summing error
-  double integral = 0;
+  controlScalar error = 0;
+  // Error from the last iteration, its derivative (the slope between
+  // iterations) and the integral after the threshold live in here
+  pidMemory<controlScalar> memory;
+  pidReset(memory);
   // Iterations of the loop. Counter used to exit loop if not converging
-  double iter = 0;
+  int iter = 0;
  
  
 
@@ -135,65 +163,74 @@ void turnPID(double angleTurn) {
   angleTurn = angleTracker - (modTracker*360);
   */
 
-  // Automated error correction loop
-  while (fabs(TurnGyroSmart.rotation(degrees) - angleTurn) > turnTolerance && iter < maxIter) 
+  // Latest sensor sample, shared with the other tasks
+  robotState state;
+  robotStateRead(state);
+  scopeStart(state.rotation, angleTurn);
+
+  // Once the drive is characterized, follow a motion profile with
+  // feedforward so the PID only corrects what the feedforward misses
+  bool useFeedforward = angularFF.kV > 0;
+  double startAngle = state.rotation;
+  double turnDirection = angleTurn >= startAngle ? 1 : -1;
+  trapezoidProfile profile(fabs(angleTurn - startAngle),
+                           feedforwardMaxVelocity(angularFF, maxSpeed),
+                           angularMaxAccel);
+  uint32_t startTime = timer::system();
+
+  // Gains for this turn size and load
+  if (load == loadAuto)
+    load = turnLoadFromState(state);
+  turnGains gains = turnGainsFor(angleTurn - startAngle, load);
+  pidGains<controlScalar> pid = {(controlScalar)gains.kP, (controlScalar)gains.kI,
+                                 (controlScalar)gains.kD, (controlScalar)turnThreshold,
+                                 (controlScalar)maxSpeed};
+
+  // Automated error correction loop. state is the one sensor read for
+  // each pass, taken at the bottom of the loop
+  while (fabs(state.rotation - angleTurn) > turnTolerance && iter < maxIter
+         && (timeout == 0 || timer::system() - startTime < timeout)) 
   {
+    scopedTimer iterTimer(turnPIDTiming);
     iter += 1;
-    error = angleTurn - TurnGyroSmart.rotation(degrees);
+
+    // Where the profile says we should be right now
+    double setpoint = angleTurn;
+    double ffVolts = 0;
+    if (useFeedforward) {
+      profilePoint ref = profile.sample((timer::system() - startTime) / 1000.0);
+      setpoint = startAngle + turnDirection * ref.position;
+      ffVolts = turnDirection * feedforwardVolts(angularFF, ref.velocity, ref.acceleration);
+    }
+
+    error = setpoint - state.rotation;
     /*if (error<-180) {
       error +=360;
     } else if (error>180) {
       error -=360;
     }*/
-    derivative = error - prevError;
-    prevError = error;
-
-    // Checking if error passes threshold to build the integral
-    if (fabs(error) < turnThreshold && error != 0) 
-    {
-      integral += error;
-    } else {
-      integral = 0;
-    }
-
-    // Voltage to use. PID calculation
-    double powerDrive = error * kP + derivative * kD + integral * kI;
 
-    // Capping voltage to max speed
-    if (powerDrive > maxSpeed) 
-    {
-      powerDrive = maxSpeed;
-    } 
-    else if (powerDrive < -maxSpeed) 
-    {
-      powerDrive = -maxSpeed;
-    }
+    // Voltage to use, capped to max speed. PID calculation
+    double powerDrive = pidStep(pid, memory, error, (controlScalar)ffVolts);
 
-    // Send to motors
-    LeftDriveSmart.spin(forward, powerDrive, voltageUnits::volt);
-    RightDriveSmart.spin(forward, -powerDrive, voltageUnits::volt);
+    // Send to motors, scaled so the same volts hold across the battery
+    LeftDriveSmart.spin(forward, batteryCompensate(powerDrive), voltageUnits::volt);
+    RightDriveSmart.spin(forward, batteryCompensate(-powerDrive), voltageUnits::volt);
+    scopePush(setpoint, state.rotation, powerDrive);
+    iterTimer.stop();
 
     this_thread::sleep_for(15);
+    robotStateRead(state);
   }
 
   // Angle achieved, brake robot
   LeftDriveSmart.stop(brake);
   RightDriveSmart.stop(brake);
 
-  // Tuning data, output to screen
+  // Tuning data, the ui task puts it on the controller screen
   turnCount += 1;
-  error = angleTurn - TurnGyroSmart.rotation(degrees);
-  derivative = error - prevError;
-  Controller1.Screen.clearScreen();
-  Controller1.Screen.setCursor(1, 1);
-  Controller1.Screen.print("Turn #: %d", turnCount);
-  Controller1.Screen.setCursor(1, 13);
-  Controller1.Screen.print("iter: %.0f", iter);
-  Controller1.Screen.newLine();
-  Controller1.Screen.print("error: %.5f", error);
-  Controller1.Screen.newLine();
-  Controller1.Screen.print("derivative: %.5f", derivative);
-  Controller1.Screen.newLine();
+  error = angleTurn - state.rotation;
+  reportMove(turnCount, iter, error, error - memory.prevError);
 }
 
 
@@ -212,16 +249,16 @@ double dkP = 0.15;
 
 
 
-double tickDistance = 0;
-
-//drivetrain wheel diameter in inches
-double wheelDiameter = 4;
-
 //pi
 double pi = 3.14159265358979;
 
-// total ticks in encoder
-double eTicks = 900;
+//driveTo's PID error is in ticks, 900 per turn of a 4 in wheel per foot
+//like it always was, so dkP/dkI/dkD and driveThreshold keep their tuning.
+//the distance itself comes from the measured wheel travel
+const double ticksPerFoot = 900 / (4 * pi);
+
+// Most volts the feedforward profile plans for
+double driveMaxVolts = 10;
 
 //drive threshold for integral 
 // needs to be tuned
@@ -229,86 +266,123 @@ double eTicks = 900;
 double driveThreshold = 9;
 
 
-//function to say drive x distance in ft
-void driveTo (double targetDistance) 
+//encoder degrees to the same ticks as tickDistance, from the measured
+//wheel travel (this used to be deg * 2.5 / wheelConstant, a 12 in turn)
+double ticksDriven(double degrees)
 {
-  //reset motor encoders so they are all zero
-  //this way the ticks match up without worrying about turning
-  BackLeft.resetRotation();
-  BackRight.resetRotation();
-  FrontLeft.resetRotation();
-  FrontRight.resetRotation();
+  return geometryInches(fabs(degrees)) / 12 * ticksPerFoot;
+}
 
+//function to say drive x distance in ft
+//gives up early if the robot is blocked or the move takes longer than
+//timeout msec (0 picks one from the distance) and says why it ended
+moveResult driveTo (double targetDistance, uint32_t timeout = 0) 
+{
 //declaration of local variables
-  double integral = 0;
-  double error = 0;
-  double derivative = 0;
-  double prevError =0;
+//(previous error, derivative and integral are in memory)
+  controlScalar error = 0;
+  pidMemory<controlScalar> memory;
+  pidReset(memory);
+  pidGains<controlScalar> pid = {(controlScalar)dkP, (controlScalar)dkI,
+                                 (controlScalar)dkD, (controlScalar)driveThreshold, 0};
 //converting target distance into ticks
-  tickDistance = fabs(targetDistance / (wheelDiameter * pi) *eTicks);
-  double wheelConstant = wheelDiameter * pi * 1;
+  double tickDistance = fabs(targetDistance * ticksPerFoot);
 
 //while loop
 //checks desired distance against sensor of current distance driven
 // 10 allows us to have a threshold for ticks so if its close enough it stops but check math in case 10 is too high
 //Check if threshold and this threshold need to be same
-  while (fabs(tickDistance) > (fabs(FrontRight.rotation(rotationUnits::deg)) * 2.5 / wheelConstant) 
-          || (fabs(tickDistance) - (fabs(FrontRight.rotation(rotationUnits::deg)) * 2.5 / wheelConstant) > 10)) 
+//distance is counted from where the encoders are now instead of resetting
+//them, odometry keeps using the same encoders
+  robotState state;
+  robotStateRead(state);
+  double startPosition = state.rightPosition;
+  double driven = 0;
+  scopeStart(0, tickDistance);
+
+//feedforward along a motion profile once the drive is characterized
+  bool useFeedforward = linearFF.kV > 0 && targetDistance != 0;
+  double targetInches = fabs(targetDistance * 12);
+  double ticksPerInch = targetInches > 0 ? tickDistance / targetInches : 0;
+  trapezoidProfile profile(targetInches,
+                           feedforwardMaxVelocity(linearFF, driveMaxVolts),
+                           linearMaxAccel);
+  uint32_t startTime = timer::system();
+
+//nothing in here used to stop a move that was pinned against something
+  moveResult result = moveDone;
+  if (timeout == 0)
+    timeout = useFeedforward ? (uint32_t)(profile.duration() * 1500) + 1000
+                             : (uint32_t)(fabs(targetDistance) * 1000) + 1500;
+  stallDetector stall;
+  stallStart(stall);
+  double commanded = 0;
+
+//driven is worked out once per sensor read, at the bottom of the loop
+  while (fabs(tickDistance) > driven 
+          || (fabs(tickDistance) - driven > 10)) 
   {
-//error is tick distance - sensor
-    error = tickDistance - (fabs(FrontRight.rotation(rotationUnits::deg)) * 2.5 / wheelConstant);
-//assign derivative 
-    derivative = error - prevError;
-    //assign previous error as the error before
-    prevError = error;
-
-//if error is less than threshold and error is not 0 add integral + error to integral
-    if (fabs(error) < driveThreshold && error != 0)
-    {
-      integral += error;
-      //else nothing
-    } else {
-      integral = 0;
+    scopedTimer iterTimer(driveToTiming);
+//setpoint is the profile position (or the whole distance without feedforward)
+    double setpoint = tickDistance;
+    double ffVolts = 0;
+    if (useFeedforward) {
+      profilePoint ref = profile.sample((timer::system() - startTime) / 1000.0);
+      setpoint = ref.position * ticksPerInch;
+      ffVolts = feedforwardVolts(linearFF, ref.velocity, ref.acceleration);
     }
-//end of if
+//error is setpoint - sensor
+    error = setpoint - driven;
 
 //declare and assign powerdrive (I.E. velocity control PID)
-   double powerDrive = (error * dkP) + (derivative * dkD) + (integral * dkI);
+//integral only builds while error is under driveThreshold
+   double powerDrive = pidStep(pid, memory, error, (controlScalar)ffVolts);
+   commanded = fabs(powerDrive) / 12 * 100;
 
    //if the distance is positive drive forward
     if(targetDistance > 0) 
     {
-      LeftDriveSmart.spin(forward,powerDrive,voltageUnits::volt);
-      RightDriveSmart.spin(forward,powerDrive,voltageUnits::volt);
+      LeftDriveSmart.spin(forward,batteryCompensate(powerDrive),voltageUnits::volt);
+      RightDriveSmart.spin(forward,batteryCompensate(powerDrive),voltageUnits::volt);
     }
     //end of positive drive if
 
     //if the distance is negative drive reverse
     if (targetDistance < 0) 
     {
-      LeftDriveSmart.spin(reverse,powerDrive,voltageUnits::volt);
-      RightDriveSmart.spin(reverse,powerDrive,voltageUnits::volt);
+      LeftDriveSmart.spin(reverse,batteryCompensate(powerDrive),voltageUnits::volt);
+      RightDriveSmart.spin(reverse,batteryCompensate(powerDrive),voltageUnits::volt);
     }
     //end of negative drive if
+    scopePush(setpoint, driven,
+              targetDistance > 0 ? powerDrive : -powerDrive);
+    iterTimer.stop();
 
     this_thread::sleep_for(15);
+    robotStateRead(state);
+    driven = ticksDriven(state.rightPosition - startPosition);
+    tractionApply(state);
+
+//blocked or out of time, stop where we are
+    if (stallCheck(stall, state, commanded)) {
+      result = moveStalled;
+      break;
+    }
+    if (timer::system() - startTime > timeout) {
+      result = moveTimeout;
+      break;
+    }
   }//end of while loop
     
     //tell motors to stop if target is achieved
   LeftDriveSmart.stop();
   RightDriveSmart.stop();
+  tractionRelease();
 
 //print data and assign last values
-  error = tickDistance - (fabs(FrontRight.rotation(rotationUnits::deg)) * 2.5 / wheelConstant);
-  derivative = error - prevError;
-  Controller1.Screen.clearScreen();
-  Controller1.Screen.setCursor(1, 1);
-  Controller1.Screen.setCursor(1, 13);
-  Controller1.Screen.newLine();
-  Controller1.Screen.print("error: %.5f", error);
-  Controller1.Screen.newLine();
-  Controller1.Screen.print("derivative %.5f", error);
-  Controller1.Screen.newLine();
+  error = tickDistance - driven;
+  reportMove(0, 0, error, error - memory.prevError);
+  return result;
 }//end of function
 
 
@@ -326,8 +400,13 @@ vex::competition Competition;
  * (choices)
  *
  */
-// storage for our auton selection
-int autonomousSelection = -1;
+// storage for our auton selection, written from the touch callback
+std::atomic<int> autonomousSelection(-1);
+// counts every change to the selection, staging is redone when it moves
+std::atomic<int> selectionCount(0);
+// Touch callbacks only change these, the ui task redraws the buttons
+std::atomic<int> pressedButton(-1);
+std::atomic<bool> buttonsDirty(false);
 
 // collect data for on screen button and include off and on color feedback for
 // button pric - instead of radio approach with one button on or off at a time,
@@ -354,7 +433,8 @@ button buttons[] = {
     {30, 150, 60, 60, false, 0xE00000, 0x00E000, "LFront1"},
     {150, 150, 60, 60, false, 0xE00000, 0x00E000, "L2Yellow"},
     {270, 150, 60, 60, false, 0xE00000, 0x00E000, "R1YellowPID"},
-    {390, 150, 60, 60, false, 0xE00000, 0x00E000, "skills"}};
+    {390, 150, 60, 60, false, 0xE00000, 0x00E000, "skills"},
+    {390, 95, 60, 50, false, 0xE00000, 0x00E000, "Replay"}};
 
 // forward ref
 void displayButtonControls(int index, bool pressed);
@@ -404,7 +484,8 @@ void userTouchCallbackPressed() {
   int ypos = Brain.Screen.yPosition();
 
   if ((index = findButton(xpos, ypos)) >= 0) {
-    displayButtonControls(index, true);
+    pressedButton = index;
+    buttonsDirty = true;
   }
 }
 
@@ -430,9 +511,10 @@ void userTouchCallbackReleased() {
 
     // save as auton selection
     autonomousSelection = index;
-
-    displayButtonControls(index, false);
+    selectionCount += 1;
   }
+  pressedButton = -1;
+  buttonsDirty = true;
 }
 
 /*-----------------------------------------------------------------------------*/
@@ -440,6 +522,7 @@ void userTouchCallbackReleased() {
 /*-----------------------------------------------------------------------------*/
 
 void displayButtonControls(int index, bool pressed) {
+  scopedTimer drawTimer(buttonDrawTiming);
   vex::color c;
   Brain.Screen.setPenColor(vex::color(0xe0e0e0));
 
@@ -473,6 +556,87 @@ void displayButtonControls(int index, bool pressed) {
   }
 }
 
+/*-----------------------------------------------------------------------------*/
+/** @brief      Auton selection page of the Brain screen */
+/*-----------------------------------------------------------------------------*/
+
+void drawAutonPage(bool full) {
+  if (full) {
+    // Make nice background
+    Brain.Screen.setFillColor(vex::color(0x404040));
+    Brain.Screen.setPenColor(vex::color(0x404040));
+    Brain.Screen.drawRectangle(0, 0, 480, 120);
+    Brain.Screen.setFillColor(vex::color(0x808080));
+    Brain.Screen.setPenColor(vex::color(0x808080));
+    Brain.Screen.drawRectangle(0, 120, 480, 120);
+
+    buttonsDirty = true;
+  }
+
+  // Buttons after a touch, on the ui task so the drawing doesn't interleave
+  // with the rest of the page
+  if (buttonsDirty.exchange(false)) {
+    Brain.Screen.setFont(fontType::mono20);
+    int pressed = pressedButton;
+    displayButtonControls(pressed, pressed >= 0);
+  }
+
+  // Team banner while disabled
+  if (!Competition.isEnabled()) {
+    Brain.Screen.setFont(fontType::mono40);
+    Brain.Screen.setFillColor(vex::color(0xFFFFFF));
+    Brain.Screen.setPenColor(vex::color(0xc11f27));
+    Brain.Screen.printAt(0, 135, "Cibola Robotics");
+    Brain.Screen.setFont(fontType::mono20);
+  }
+
+  // What's staged and how fast the last autonomous got going
+  bool warm;
+  int32_t latency = autonStartLatency(warm);
+  Brain.Screen.setFont(fontType::mono15);
+  Brain.Screen.setFillColor(vex::color(0x808080));
+  Brain.Screen.setPenColor(vex::color(0x808080));
+  Brain.Screen.drawRectangle(0, 218, 480, 22);
+  Brain.Screen.setPenColor(vex::color(0xFFFFFF));
+  Brain.Screen.printAt(5, 234, "%-36s", autonPrepareStatus());
+  if (latency >= 0)
+    Brain.Screen.printAt(300, 234, "start %ld ms (%s)", (long)latency,
+                         warm ? "warm" : "cold");
+  Brain.Screen.setFont(fontType::mono20);
+}
+
+// Selected routines in the order they run
+int selectedRoutines(const autonRoutine **routines) {
+  // Button index for each routine, in run order. Replay goes last so it
+  // drives whatever was last recorded from driver control (replay.bin)
+  const int order[] = {7, 1, 5, 2, 3, 0, 4, 6, 8};
+  const autonRoutine *table[] = {
+      &skillsRoutine,   &l1YellowRoutine, &l2YellowRoutine,
+      &r1YellowRoutine, &r2YellowRoutine, &rMidOnlyRoutine,
+      &lFront1Routine,  &r1YellowPIDRoutine, &replayRoutine};
+
+  int count = 0;
+  for (int i = 0; i < sizeof(order) / sizeof(int); i++)
+    if (buttons[order[i]].state)
+      routines[count++] = table[i];
+  return count;
+}
+
+// Stage the current selection so autonomous() doesn't have to
+void prepareSelected(void) {
+  const autonRoutine *routines[9];
+  int selection = selectionCount;
+  int count = selectedRoutines(routines);
+  autonPrepare(routines, count, selection);
+}
+
+void autonPageTouch(int xpos, int ypos, bool pressed) {
+  if (pressed)
+    userTouchCallbackPressed();
+  else
+    userTouchCallbackReleased();
+}
+
 using namespace vex;
 
 // define your global instances of motors and other devices here
@@ -493,6 +657,36 @@ void pre_auton(void) {
 
   // All activities that occur before the competition starts
   // Example: clearing encoders, setting servo positions, ...
+
+  // Brain screen pages, auton selection is the one shown at startup
+  brainPage autonPage = {"Auton", drawAutonPage, autonPageTouch};
+  pageAdd(autonPage);
+  timingInit();
+  scopeInit();
+
+  // Off the field tests, run from driver control
+  testInit();
+  testAdd("Lift bench", []() { liftBenchmark(5, 600); });
+  testAdd("FF linear", characterizeLinear);
+  testAdd("FF angular", characterizeAngular);
+  testAdd("Wheel travel", calibrateWheelTravel);
+  testAdd("Track width", calibrateTrackWidth);
+  testAdd("Square back", []() { squareToWall(reverse, 0, axisY, 0); });
+  testAdd("PID bench", pidBenchmark);
+
+  // Tuning values, measured geometry and fitted feedforward from the
+  // SD card
+  configInit();
+  geometryLoad();
+  feedforwardLoad();
+
+  // Start the sensor/ui tasks, the synced lift task and the motor monitor
+  runtimeInit();
+  liftInit();
+  healthInit();
+
+  // Stage whatever is selected already, main keeps it up to date
+  prepareSelected();
 }
 
 /*---------------------------------------------------------------------------*/
@@ -507,321 +701,22 @@ void pre_auton(void) {
 
 // Autonomous function opns
 void autonomous(void) {
+  // The match clock and the start latency count from here
+  uint32_t entry = timer::system();
+  runtimeControlThread();
+  healthFullTorqueAll();
+  tractionRelease();
   // ..........................................................................
   // Insert autonomous user code here.
   // ..........................................................................
-  /* initialize capabilities from buttons */
-
-  // Bool statements for when code is running to press before competition starts
-  bool RMidOnly = buttons[0].state;
-  bool Skills = buttons[7].state;
-  bool R1Yellow = buttons[2].state;
-  bool R2Yellow = buttons[3].state;
-  bool L1Yellow = buttons[1].state;
-  bool L2Yellow = buttons[5].state;
-  bool  R1YellowPID= buttons[6].state;
-  bool LFront1 = buttons[4].state;
-
-  if (Skills) {
-
-    //..........Starting Skills..........//
-    // Set stopping functions for rest of the code  
-  
-    Drivetrain.setStopping(brake);
-    Claw.setStopping(brakeType::hold);
-    Back.setStopping(brakeType::hold);
-    //lower back lift
-    Back.spinFor(forward,500,degrees,80,velocityUnits::pct);
-    //drive enough for back lift to be under goal to starting position
-    //driveTo(-12/12);
-    Drivetrain.driveFor(reverse,12,inches,70,velocityUnits::pct);
-    //Drivetrain.stop(brake);
-    wait(.3,sec);
-    //wait to ensure it is on lift
-    Back.spinFor(reverse,440,degrees,80,velocityUnits::pct);
-    //pick up goal on platform with the back
-    //turn to head to left yellow goal
-    turnPID(83);
-    //turnPID(87);
-    //drive forward then turn to allow claw to face goal
-    driveTo(1.91);
-    //Drivetrain.driveFor(forward,23,inches,90,velocityUnits::pct);
-    turnPID(5+86);
-    //turnPID(8.75);
-    //drive till the yellow goal is reached
-    driveTo(2.2);
-    //Drivetrain.driveFor(forward,23.5,inches,60,velocityUnits::pct);
-
-
-    //Drivetrain.driveFor(forward,49,inches,90,velocityUnits::pct);
-    //Drivetrain.stop(brake);
-    //wait to avoid overshooting
-    //wait(.2,sec);
-    //spin claw and lift to pick up left yellow goal
-    Claw.spinFor(reverse,140,degrees,80,velocityUnits::pct);
-    Lift.spinFor(reverse,320,degrees,80,velocityUnits::pct);
-    //drive forward holding goal
-    Drivetrain.driveFor(forward,32,inches,90,velocityUnits::pct);
-    wait(.2,sec);
-    //turn to start reaching platform
-    turnPID(133);
-    //drive forward
-    //robot should be in front of platform at an angle
-    Drivetrain.driveFor(forward,14,inches,80,velocityUnits::pct);
-    //spin claw to get a better grip as we raise the lift.
-    //Claw.spinFor(reverse,40,degrees,60,velocityUnits::pct,false);
-    Lift.spinFor(reverse,900,degrees,80,velocityUnits::pct,true);
-    //drive closer to the goal
-    Drivetrain.driveFor(forward,8,inches,15,velocityUnits::pct);
-    //turn to be parallel with platform
-    turnPID(179);
-    //drive forward so the front wheels are in line with platform stand
-    Drivetrain.driveFor(forward,6.5,inches,40,velocityUnits::pct);
-    //wait to stop drift
-    wait(.2,sec);
-    //spin only the right side of chassis
-    //to slide in between the black platform stand 
-    RightDriveSmart.spinFor(forward,750,degrees,60,velocityUnits::pct);
-    Drivetrain.driveFor(forward,2,inches,60,velocityUnits::pct);
-    //lower lift and release claw
-    Lift.spinFor(forward,550,degrees,90,velocityUnits::pct);
-    Claw.spinFor(forward,100,degrees,90,velocityUnits::pct);
-    Drivetrain.driveFor(reverse,5,inches,60,velocityUnits::pct);
-    //reverse enough to drop goal
-    //raise lift to get over platform edge
-    Lift.spinFor(reverse,100,deg,80,velocityUnits::pct);
-    Drivetrain.driveFor(reverse,4,inches,60,velocityUnits::pct);
-    //back out of platform
-    Claw.spinFor(forward,40,deg,90,velocityUnits::pct,false);
-    Lift.spinFor(forward,900,degrees,90,velocityUnits::pct);
-    //return lift and claw to starting position
-
-    turnPID(180);
-    //turn to right 90
-    Back.spinFor(forward,450,degrees,90,velocityUnits::pct);
-    //lower the back
-    Drivetrain.driveFor(forward,14,inches,70,velocityUnits::pct);
-    Back.spinFor(reverse,400,deg,80,velocityUnits::pct);
-    //drop goal in back lift and drive forward
-    //turn to face goal with claw
-    turnPID(0);
-    //drive to reach alliance goal 
-    Drivetrain.driveFor(forward,14.5,inches,65,velocityUnits::pct);
-    //pick up the goal and raise it
-    Claw.spinFor(reverse,140,deg,80,velocityUnits::pct);
-    Lift.spinFor(reverse,1100,deg,80,velocityUnits::pct);
-    turnPID(70);
-    //turn to platform
-    Drivetrain.driveFor(forward,10,inches,40,velocityUnits::pct);
-    turnPID(105);
-    Drivetrain.driveFor(forward,7,inches,40,velocityUnits::pct);
-    //drive forward then turn and drive again to push neutral goal toward side
-    Lift.spinFor(forward,250,deg,80,velocityUnits::pct);
-    Claw.spinFor(forward,100,degrees,90,velocityUnits::pct);
-    Drivetrain.driveFor(reverse,7.5,inches,60,velocityUnits::pct);
-    Lift.spinFor(reverse,150,deg,80,velocityUnits::pct);
-    Drivetrain.driveFor(reverse,7.5,inches,60,velocityUnits::pct);
-    Claw.spinFor(forward,40,deg,90,velocityUnits::pct,false);
-    Lift.spinFor(forward,900,degrees,90,velocityUnits::pct);
-    //drop goal and return lift to position
-    turnPID(185);
-    Drivetrain.driveFor(reverse,13.5,inches,60,velocityUnits::pct,false);
-    //turn to alliance corner goal
-    //Back.spinFor(forward,400,deg,70,velocityUnits::pct);
-    Back.spinFor(forward,400,deg,70,velocityUnits::pct,true);
-    Drivetrain.driveFor(reverse,25,inches,60,velocityUnits::pct);
-    Back.spinFor(reverse,400,deg,90,velocityUnits::pct);
-    //back into the corner goal
-
-    //Claw.spinFor(reverse,140,deg,80,velocityUnits::pct);
-    //Lift.spinFor(reverse,40,degrees,90,velocityUnits::pct);
-    turnPID(180+30);
-
-    //Drivetrain.driveFor(forward,47,inches,60,velocityUnits::pct);
-    Drivetrain.driveFor(forward,127,inches,60,velocityUnits::pct);
-    /*
-    Claw.spinFor(reverse,120,deg,90,velocityUnits::pct);
-    Lift.spinFor(reverse,330,deg,90,velocityUnits::pct);
-    turnPID(180);
-    Drivetrain.driveFor(forward,36,inches,100,velocityUnits::pct);
-    turnPID(270);
-    Drivetrain.driveFor(forward,50,inches,90,velocityUnits::pct);
-    */
-
-    //...............END OF CODE...............//
-  }
-
-  if (L1Yellow) {
-
-    //..........Starting..........//
-
-    // Set stopping functions for the rest of the code
-    Drivetrain.setStopping(brake);
-    Claw.setStopping(brakeType::hold);
-    Back.setStopping(brakeType::hold);
-    Back.spinFor(forward,500,degrees,100,velocityUnits::pct,false);
-    //spin back u lift to resting on the ground
-    wait(.2,sec);
-    //wait so the lift is down far enough before driving
-    Drivetrain.driveFor(reverse,50,inches,100,velocityUnits::pct);
-    //drive towards the goal
-
-    //auton left yellow middle
-    //include auton left yellow only
-    //spin back u lift up so the goal is nestled
-    Back.spinFor(reverse,300,degrees,80,velocityUnits::pct);
-    //drive back to start
-    driveTo(4.16);
-
-    //..........Prepare for User Control..........//
-  }
-
-  if (L2Yellow) {
-
-    //..........Starting..........//
-    Drivetrain.setStopping(brake);
-    Claw.setStopping(brakeType::hold);
-    Back.setStopping(brakeType::hold);
-    // Set stopping functions for the rest of the code
-    Back.spinFor(forward,500,degrees,100,velocityUnits::pct,false);
-    //spin back u lift to resting on the ground
-    wait(.2,sec);
-    //wait so the lift is down far enough before driving
-    Drivetrain.driveFor(reverse,50,inches,100,velocityUnits::pct);
-    //drive towards the goal
-
-    //auton left yellow middle
-    //include auton left yellow only
-    //spin back u lift up so the goal is nestled
-    Back.spinFor(reverse,300,degrees,80,velocityUnits::pct);
-    //drive back to start
-
-    //from picking up left neutral goal
-    //turn to face an angle to avoid rings
-    turnPID(-84);
-    //drive most of  the way to the middle neutral goal
-    Drivetrain.driveFor(forward,15,inches,100,velocityUnits::pct);
-    //turn to face the goal
-    turnPID(-130);
-    wait(.2,sec);
-    //drive to goal
-    Drivetrain.driveFor(forward,5,inches,60,velocityUnits::pct);
-    //wait to make sure no skiding
-    wait(.2,sec);
-    //clamp the claw down 
-    Claw.spinFor(reverse,140,degrees,80,velocityUnits::pct);
-    //turn with goal
-    turnPID(10);
-    //drive back to start
-    Drivetrain.driveFor(forward,30,inches,90,velocityUnits::pct);
-
-
-    //..........Prepare for User Control..........//
-  }
-
-  if (R1Yellow) {
-
-    //..........Starting..........//
-    Drivetrain.setStopping(brake);
-    Claw.setStopping(brakeType::hold);
-    Back.setStopping(brakeType::hold);
-
-    Drivetrain.driveFor(forward,43,inches,100,velocityUnits::pct);
-    wait(.2,sec);
-    Claw.spinFor(reverse,130,degrees,100,velocityUnits::pct);
-    Drivetrain.driveFor(reverse,42,inches,100,velocityUnits::pct);
-
-    //..........Prepare for User Control..........//
-  }
-
-  if (R2Yellow) {
-
-    //..........Starting..........//
-    Drivetrain.setStopping(brake);
-    Claw.setStopping(brakeType::hold);
-    Back.setStopping(brakeType::hold);
-    //set stopping
-
-    //Drive until at goal
-    driveTo(3.61);
-    //Grab goal and pick up lift to avoid drag
-    Claw.spinFor(reverse,140,degrees,80,velocityUnits::pct);
-    Lift.spinFor(reverse,120,degrees,90,velocityUnits::pct);
-    //reverse and turn until first goal is scored
-    Drivetrain.driveFor(reverse,12,inches,100,velocityUnits::pct);  
-    turnPID(120);
-    //Drop the goal
-    Claw.spinFor(forward,130,degrees,100,velocityUnits::pct);
-    //Lower back lift
-    Back.spinFor(forward,500,deg,90,velocityUnits::pct);
-    //Reverse into middle goal and lift
-    Drivetrain.driveFor(reverse,32,inches,100,velocityUnits::pct);
-    Back.spinFor(reverse,200,deg,90,velocityUnits::pct);
-    //wait to ensure secure
-    wait(.2,sec);
-    //Drive until in the zone
-    Drivetrain.driveFor(forward,14,inches,100,velocityUnits::pct);
-    //turn and drive until in line with goal
-    turnPID(160);
-    Drivetrain.driveFor(forward,27,inches,100,velocityUnits::pct);
-    //turn right so claw can pick up goal
-    turnPID(90);
-    //..........Prepare for User Control..........//
-  }
-
-  if (RMidOnly) {
-
-    //..........Starting..........//
-    Drivetrain.setStopping(brake);
-    Claw.setStopping(brakeType::hold);
-    Back.setStopping(brakeType::hold);
-    //set stopping
-    //Drive forward 18 inches
-    Drivetrain.driveFor(forward,18,inches,100,velocityUnits::pct);
-    //Turn left to align with middle goal
-    turnPID(-38);
-    //Drive until at goal
-    Drivetrain.driveFor(forward,38.5,inches,100,velocityUnits::pct);
-    //wait to ensure there is no skid
-    wait(.2,sec);
-    //Grab goal with claw
-    Claw.spinFor(reverse,130,degrees,80,velocityUnits::pct);
-    //Drive reverse until scored
-    Drivetrain.driveFor(reverse,40,inches,100,velocityUnits::pct);
-    //..........Prepare for User Control..........//
-  }
-
-  if (LFront1) {
-    //..........Starting..........//
-    Drivetrain.setStopping(brake);
-    Claw.setStopping(brakeType::hold);
-    Back.setStopping(brakeType::hold);
-    // Set stopping functions for the rest of the code
-    //Use PID drive to drive 49 inches to goal
-    driveTo(4.16);
-    //Spin the claw down clutching goal
-    Claw.spinFor(reverse,130,deg,100,velocityUnits::pct);
-    //Reverse while holding goal until scored
-    Drivetrain.driveFor(reverse,50,inches,100,velocityUnits::pct);
-
-    //.......Prepare for User Control...............//
-  }
 
-  if (R1YellowPID) {
-
-    //..........Starting..........//
-    Drivetrain.setStopping(brake);
-    Claw.setStopping(brakeType::hold);
-    Back.setStopping(brakeType::hold);
-    // Set stopping functiions for the rest of the code
-    //Drive unitl goal
-    driveTo(3.6);
-    //Spin claw and drive away with goal
-    Claw.spinFor(reverse,130,degrees,100,velocityUnits::pct);
-    Drivetrain.driveFor(reverse,42,inches,100,velocityUnits::pct);
-    //driveTo(-3.5);
-    //..........Prepare for User Control..........//
-  }
+  // Routines are step tables in auton-routines.h, staged from the buttons
+  // while disabled. Stage now if the selection changed too late or
+  // something wasn't ready. The runner keeps them inside the match clock
+  // and logs how long each step took
+  if (!autonPrepared(selectionCount))
+    prepareSelected();
+  autonRunPrepared(entry);
 }
 
   //...............END OF CODE...............//
@@ -837,21 +732,23 @@ void autonomous(void) {
 /*  You must modify the code to add your own robot specific commands here.   */
 /*                                                                           */
 /*---------------------------------------------------------------------------*/
-bool halfspeed = false;
-bool soloControl = false;
-void solo() {soloControl = !soloControl;}
-
-void halfspeedcontrol() { halfspeed = !halfspeed; }
+// Record driver inputs for replay, never while on a field
+void recordToggle() {
+  if (!Competition.isFieldControl())
+    inputLogToggle();
+}
 
 void usercontrol(void) {
+  runtimeControlThread();
 
-  int threshold = 20, ChasLfVar = 0, ChasRtVar = 0;
-  Controller1.ButtonA.pressed(halfspeedcontrol);
-  Controller1.ButtonB.pressed(solo);
+  driverControlInit();
+  Controller1.ButtonY.pressed(recordToggle);
 
-  
+  // Fixed rate so a recording replays with the same timing
+  uint32_t nextPass = timer::system();
 
   while (1) {
+    scopedTimer passTimer(userControlTiming);
     // This is the main execution loop for the user control program.
     // Each time through the loop your program should update motor + servo
     // values based on feedback from the joysticks.
@@ -860,143 +757,26 @@ void usercontrol(void) {
     // update your motors, etc.
     // ........................................................................
 
-    // TestAuton Callback Function //
-    Controller1.ButtonA.pressed(halfspeedcontrol);
-    Controller1.ButtonB.pressed(solo);
-
-
-    // Tank Drivetrain //
-
-    // Left Side Chassis
-//test for if solo button pressed drive contols switch to solo 1 controller
-    if (soloControl ==true) 
-    {
-      if (abs(Controller1.Axis3.position(percentUnits::pct)) > threshold) 
-      {
-        ChasLfVar = Controller1.Axis3.position(percentUnits::pct);
-      } else {
-        ChasLfVar = 0;
-        LeftDriveSmart.stop(brakeType::brake);
-      }
-
-    // Right Side Chassis
-
-      if (abs(Controller1.Axis2.position(percentUnits::pct)) > threshold) 
-      {
-        ChasRtVar = Controller1.Axis2.position(percentUnits::pct);
-      } else {
-        ChasRtVar = 0;
-        RightDriveSmart.stop(brakeType::brake);
-      }
-      // halfspeed control
-      if (halfspeed == true) {
-        LeftDriveSmart.spin(directionType::fwd, ChasLfVar * .50,percentUnits::pct);
-        RightDriveSmart.spin(directionType::fwd, ChasRtVar * .50, percentUnits::pct);
-
-      } else {
-        LeftDriveSmart.spin(directionType::fwd, ChasLfVar, percentUnits::pct);
-        RightDriveSmart.spin(directionType::fwd, ChasRtVar, percentUnits::pct);
-      }
-
-    
-    // Claw Controls //
-
-      if (Controller1.ButtonL2.pressing()) 
-      {
-        Claw.spin(directionType::fwd, 100, velocityUnits::pct);
-      } else if (Controller1.ButtonR2.pressing()) {
-        Claw.spin(directionType::rev, 100, velocityUnits::pct);
-      } else {
-        Claw.stop(brakeType::hold);
-      }
-
-      // Lift Controls //
-
-      if (Controller1.ButtonDown.pressing()) 
-      {
-        Lift.spin(directionType::fwd,100,velocityUnits::pct);
-      } else if (Controller1.ButtonUp.pressing()) {
-        Lift.spin(directionType::rev,100,velocityUnits::pct);
-      } else {
-        Lift.stop(brakeType::hold);
-      }
-
-      // Back Controls //
-
-      if (Controller1.ButtonL1.pressing()) 
-      {
-        Back.spin(directionType::fwd, 100, velocityUnits::pct);
-      } else if (Controller1.ButtonR1.pressing()) {
-        Back.spin(directionType::rev, 100, velocityUnits::pct);
-      } else {
-        Back.stop(brakeType::hold);
-      }
-    } else {
-    //normal drive code after
-    
-
-      if (abs(Controller1.Axis3.position(percentUnits::pct)) > threshold) 
-      {
-        ChasLfVar = Controller1.Axis3.position(percentUnits::pct);
-
-      } else {
-        ChasLfVar = 0;
-        LeftDriveSmart.stop(brakeType::brake);
-      }
-
-      // Right Side Chassis
-
-      if (abs(Controller1.Axis2.position(percentUnits::pct)) > threshold) 
-      {
-        ChasRtVar = Controller1.Axis2.position(percentUnits::pct);
-      } else {
-        ChasRtVar = 0;
-        RightDriveSmart.stop(brakeType::brake);
-      }
-      // halfspeed control
-      if (halfspeed == true) {
-        LeftDriveSmart.spin(directionType::fwd, ChasLfVar * .50,percentUnits::pct);
-        RightDriveSmart.spin(directionType::fwd, ChasRtVar * .50, percentUnits::pct);
-
-      } else {
-        LeftDriveSmart.spin(directionType::fwd, ChasLfVar, percentUnits::pct);
-        RightDriveSmart.spin(directionType::fwd, ChasRtVar, percentUnits::pct);
-      }
-
-    
-      // Claw Controls //
-
-      if (Controller2.ButtonR1.pressing()) {
-        Claw.spin(directionType::fwd, 100, velocityUnits::pct);
-      } else if (Controller2.ButtonR2.pressing()) {
-        Claw.spin(directionType::rev, 100, velocityUnits::pct);
-      } else {
-        Claw.stop(brakeType::hold);
-      }
-
-      // Lift Controls //
-
-      if (Controller2.ButtonL2.pressing()) {
-        Lift.spin(directionType::fwd,100,velocityUnits::pct);
-      } else if (Controller2.ButtonL1.pressing()) {
-        Lift.spin(directionType::rev,100,velocityUnits::pct);
-      } else {
-        Lift.stop(brakeType::hold);
-      }
-
-      // Back Controls //
-
-      if (Controller1.ButtonL1.pressing()) {
-        Back.spin(directionType::fwd, 100, velocityUnits::pct);
-      } else if (Controller1.ButtonR1.pressing()) {
-        Back.spin(directionType::rev, 100, velocityUnits::pct);
-      } else {
-        Back.stop(brakeType::hold);
-      }
+    // Tests queued from the Brain Tests page, only when not on a field //
+    if (!Competition.isFieldControl()) {
+      testPoll();
     }
 
-  wait(100,msec);
-}
+    // Tank drive and mechanisms from the controllers, with heading hold
+    // when both sticks are together and torque cut on a slipping side //
+    driverInput input;
+    readDriverInput(input);
+    robotState state;
+    robotStateRead(state);
+    tractionApply(state);
+    double leftCorrection, rightCorrection;
+    headingHold(input, state, leftCorrection, rightCorrection);
+    applyDriverInput(input, leftCorrection, rightCorrection);
+    inputLogRecord(input);
+
+    passTimer.stop();
+    runtimeSleepUntil(nextPass, driverPeriod);
+  }
 }
 // Main will set up the competition functions and callbacks
 
@@ -1012,32 +792,21 @@ int main() {
   Competition.autonomous(autonomous);
   Competition.drivercontrol(usercontrol);
 
-  // Register events for button selection
-  Brain.Screen.pressed(userTouchCallbackPressed);
-  Brain.Screen.released(userTouchCallbackReleased);
-
-  // Make nice background
-  Brain.Screen.setFillColor(vex::color(0x404040));
-  Brain.Screen.setPenColor(vex::color(0x404040));
-  Brain.Screen.drawRectangle(0, 0, 480, 120);
-  Brain.Screen.setFillColor(vex::color(0x808080));
-  Brain.Screen.setPenColor(vex::color(0x808080));
-  Brain.Screen.drawRectangle(0, 120, 480, 120);
-
-  // Initial Display
-  displayButtonControls(0, false);
+  // Register events for button selection and page switching
+  // (the ui task draws the pages)
+  pageInit();
 
 
 //12951
 //2.7w motor
   // While loop to call back functions to run during competition
+  // (the banner is drawn by the ui task)
   while (1) {
+    // Keep the selected autonomous staged while disabled
+    if (!Competition.isEnabled() && !autonPrepared(selectionCount))
+      prepareSelected();
+
     // Allow other tasks to run
-    if (!Competition.isEnabled())
-      Brain.Screen.setFont(fontType::mono40);
-      Brain.Screen.setFillColor(vex::color(0xFFFFFF));
-      Brain.Screen.setPenColor(vex::color(0xc11f27));
-      Brain.Screen.printAt(0, 135, "Cibola Robotics");
-      this_thread::sleep_for(10);
+    this_thread::sleep_for(100);
   }
 }
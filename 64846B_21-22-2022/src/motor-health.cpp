@@ -0,0 +1,201 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       motor-health.cpp                                          */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Motor temperature/current monitor and hold derating       */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <atomic>
+
+#include "motor-health.h"
+#include "brain-pages.h"
+#include "robot-state.h"
+#include "runtime.h"
+
+double healthWarnTemp = 50;
+double healthDerateTemp = 45;
+
+// Sample every 500 msec and keep the last 60 (30 seconds)
+const uint32_t healthPeriod = 500;
+const int historyLength = 60;
+
+typedef struct _motorHealth {
+  const char *name;
+  motor *m;
+  // Lowest hold torque (percent) derating may go to. Claw and back hold
+  // goals, so they keep more
+  double holdFloor;
+  // Torque limit currently applied, so it is only sent when it changes
+  double torque;
+  bool warned;
+
+  float temperature[historyLength];
+  float current[historyLength];
+  float voltage[historyLength];
+  float efficiency[historyLength];
+} motorHealth;
+
+motorHealth motors[] = {
+    {"Back", &Back, 60, 100, false, {}, {}, {}, {}},
+    {"Claw", &Claw, 70, 100, false, {}, {}, {}, {}},
+    {"LiftA", &LiftA, 50, 100, false, {}, {}, {}, {}},
+    {"LiftB", &LiftB, 50, 100, false, {}, {}, {}, {}},
+    {"FrontLeft", &FrontLeft, 100, 100, false, {}, {}, {}, {}},
+    {"BackLeft", &BackLeft, 100, 100, false, {}, {}, {}, {}},
+    {"FrontRight", &FrontRight, 100, 100, false, {}, {}, {}, {}},
+    {"BackRight", &BackRight, 100, 100, false, {}, {}, {}, {}}};
+
+const int motorCount = sizeof(motors) / sizeof(motorHealth);
+
+// Next history slot, the newest sample is one before it
+std::atomic<int> historyNext(0);
+int historyCount = 0;
+
+// Written by the monitor task only, published for the ui task
+healthMessage warning = {0, ""};
+seqlock<healthMessage> sharedWarning;
+
+static motorHealth *findMotor(motor &m) {
+  for (int i = 0; i < motorCount; i++)
+    if (motors[i].m == &m)
+      return &motors[i];
+  return NULL;
+}
+
+static int newest(void) {
+  return (historyNext + historyLength - 1) % historyLength;
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Derating, called from the driver loop */
+/*-----------------------------------------------------------------------------*/
+
+static void setTorque(motorHealth &health, double torque) {
+  if (torque != health.torque) {
+    health.m->setMaxTorque(torque, percentUnits::pct);
+    health.torque = torque;
+  }
+}
+
+void healthHoldTorque(motor &m) {
+  motorHealth *health = findMotor(m);
+  if (health == NULL || historyCount == 0)
+    return;
+
+  // Full torque up to the derate temperature, down to the floor at the
+  // warning temperature
+  double temp = health->temperature[newest()];
+  double fraction = (temp - healthDerateTemp) / (healthWarnTemp - healthDerateTemp);
+  if (fraction < 0)
+    fraction = 0;
+  if (fraction > 1)
+    fraction = 1;
+  setTorque(*health, 100 - fraction * (100 - health->holdFloor));
+}
+
+void healthFullTorque(motor &m) {
+  motorHealth *health = findMotor(m);
+  if (health != NULL)
+    setTorque(*health, 100);
+}
+
+void healthFullTorqueAll(void) {
+  for (int i = 0; i < motorCount; i++)
+    setTorque(motors[i], 100);
+}
+
+void healthWarningRead(healthMessage &message) { sharedWarning.read(message); }
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Background sampling */
+/*-----------------------------------------------------------------------------*/
+
+int healthTask() {
+  while (true) {
+    int slot = historyNext;
+    for (int i = 0; i < motorCount; i++) {
+      motorHealth &health = motors[i];
+      double temp = health.m->temperature(celsius);
+      health.temperature[slot] = temp;
+      health.current[slot] = health.m->current(amp);
+      health.voltage[slot] = health.m->voltage(volt);
+      health.efficiency[slot] = health.m->efficiency(percentUnits::pct);
+
+      // Warn once per motor, again only after it has cooled down
+      if (temp >= healthWarnTemp && !health.warned) {
+        health.warned = true;
+        snprintf(warning.text, sizeof(warning.text), "HOT %s %.0fC",
+                 health.name, temp);
+        warning.count += 1;
+        sharedWarning.write(warning);
+        Controller1.rumble("-.-");
+      } else if (temp < healthWarnTemp - 5) {
+        health.warned = false;
+      }
+    }
+    historyNext = (slot + 1) % historyLength;
+    if (historyCount < historyLength)
+      historyCount += 1;
+
+    this_thread::sleep_for(healthPeriod);
+  }
+  return 0;
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Motors page: latest numbers and a temperature trace each */
+/*-----------------------------------------------------------------------------*/
+
+// 8 rows from y=44 have to end above 240
+const int healthRow = 24;
+const int traceX = 330;
+
+static void drawHealth(bool full) {
+  Brain.Screen.setFont(fontType::mono12);
+  if (full) {
+    Brain.Screen.setPenColor(vex::color(0x808080));
+    Brain.Screen.setFillColor(vex::color::black);
+    Brain.Screen.printAt(4, 38, "motor        temp   amps  volts   eff  hold   temp 30s");
+  }
+  if (historyCount == 0)
+    return;
+
+  int last = newest();
+  for (int i = 0; i < motorCount; i++) {
+    motorHealth &health = motors[i];
+    int y = 44 + i * healthRow;
+    double temp = health.temperature[last];
+
+    Brain.Screen.setPenColor(temp >= healthWarnTemp ? vex::color(0xc11f27)
+                             : temp >= healthDerateTemp ? vex::color(0xe0c000)
+                                                        : vex::color(0xe0e0e0));
+    Brain.Screen.setFillColor(vex::color::black);
+    Brain.Screen.printAt(4, y + 16, "%-11s %5.0fC %5.2f %6.2f %4.0f%% %4.0f%%",
+                         health.name, temp, health.current[last],
+                         health.voltage[last], health.efficiency[last],
+                         health.torque);
+
+    // 30-70C across the row height, oldest on the left
+    Brain.Screen.setPenColor(vex::color::black);
+    Brain.Screen.drawRectangle(traceX, y, historyLength * 2, healthRow - 3);
+    Brain.Screen.setPenColor(vex::color(0x00a0e0));
+    for (int n = 0; n < historyCount; n++) {
+      int index = (historyNext + historyLength - historyCount + n) % historyLength;
+      double fraction = (health.temperature[index] - 30) / 40;
+      if (fraction < 0)
+        fraction = 0;
+      if (fraction > 1)
+        fraction = 1;
+      Brain.Screen.drawPixel(traceX + n * 2, y + healthRow - 4 - (int)(fraction * (healthRow - 5)));
+    }
+  }
+}
+
+void healthInit(void) {
+  static task monitor = task(healthTask, uiPriority);
+
+  brainPage page = {"Motors", drawHealth, NULL};
+  pageAdd(page);
+}
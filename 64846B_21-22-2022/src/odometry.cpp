@@ -0,0 +1,64 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       odometry.cpp                                              */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Pose from the drive encoders and inertial heading         */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <atomic>
+
+#include "odometry.h"
+#include "drive-geometry.h"
+
+// Only the sensor task touches these
+static double poseX = 0;
+static double poseY = 0;
+static double lastLeft = 0;
+static double lastRight = 0;
+static bool started = false;
+
+// Axis resets from the other tasks. The value is stored before the flag is
+// set, so the sensor task never sees the flag without it
+const int resetX = 1;
+const int resetY = 2;
+std::atomic<float> pendingX(0);
+std::atomic<float> pendingY(0);
+std::atomic<int> pendingResets(0);
+
+void odometrySetX(double x) {
+  pendingX = x;
+  pendingResets.fetch_or(resetX, std::memory_order_release);
+}
+
+void odometrySetY(double y) {
+  pendingY = y;
+  pendingResets.fetch_or(resetY, std::memory_order_release);
+}
+
+void odometryUpdate(robotState &state) {
+  if (!started) {
+    lastLeft = state.leftPosition;
+    lastRight = state.rightPosition;
+    started = true;
+  }
+
+  // Heading 0 is straight ahead at the start, clockwise positive
+  double distance = geometryInches((state.leftPosition - lastLeft +
+                                    state.rightPosition - lastRight) / 2);
+  double radians = state.rotation * 3.14159265358979 / 180;
+  poseX += distance * sin(radians);
+  poseY += distance * cos(radians);
+  lastLeft = state.leftPosition;
+  lastRight = state.rightPosition;
+
+  int resets = pendingResets.exchange(0, std::memory_order_acquire);
+  if (resets & resetX)
+    poseX = pendingX;
+  if (resets & resetY)
+    poseY = pendingY;
+
+  state.x = poseX;
+  state.y = poseY;
+}
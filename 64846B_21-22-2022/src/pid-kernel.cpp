@@ -0,0 +1,59 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       pid-kernel.cpp                                            */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  PID step shared by turnPID and driveTo                    */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "pid-kernel.h"
+#include "vex.h"
+
+// V5 brain CPU clock, for turning usec into cycles
+const double cpuMHz = 667;
+
+const int benchErrors = 256;
+const int benchIterations = 100000;
+
+// Kept outside the loop so the compiler can't drop the work
+volatile double benchSink = 0;
+
+// usec per iteration, over a made up error sequence that sweeps through
+// the integral zone like a turn settling does
+template <typename T> static double benchScalar(void) {
+  T errors[benchErrors];
+  for (int i = 0; i < benchErrors; i++)
+    errors[i] = (T)(90 * cos(i * 0.05) * exp(-i * 0.01));
+
+  pidGains<T> gains = {(T)0.15, (T)0.009, (T)0.001, (T)16, (T)8};
+  pidMemory<T> memory;
+  pidReset(memory);
+
+  T sum = 0;
+  uint64_t start = timer::systemHighResolution();
+  for (int i = 0; i < benchIterations; i++)
+    sum += pidStep(gains, memory, errors[i & (benchErrors - 1)], (T)0.5);
+  uint64_t elapsed = timer::systemHighResolution() - start;
+
+  benchSink = sum;
+  return (double)elapsed / benchIterations;
+}
+
+void pidBenchmark(void) {
+  double doubleTime = benchScalar<double>();
+  double floatTime = benchScalar<float>();
+
+  Brain.Screen.clearScreen();
+  Brain.Screen.setFont(fontType::mono20);
+  Brain.Screen.setCursor(2, 1);
+  Brain.Screen.print("pidStep, %d iterations", benchIterations);
+  Brain.Screen.newLine();
+  Brain.Screen.print("double %.3f us  %.0f cycles", doubleTime,
+                     doubleTime * cpuMHz);
+  Brain.Screen.newLine();
+  Brain.Screen.print("float  %.3f us  %.0f cycles", floatTime,
+                     floatTime * cpuMHz);
+  printf("pid bench: double %.3f us (%.0f cycles), float %.3f us (%.0f cycles)\n",
+         doubleTime, doubleTime * cpuMHz, floatTime, floatTime * cpuMHz);
+}
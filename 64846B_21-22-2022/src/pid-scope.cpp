@@ -0,0 +1,175 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       pid-scope.cpp                                             */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Live setpoint/measurement/output plot on the Brain screen */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "pid-scope.h"
+#include "brain-pages.h"
+#include "spsc-ring.h"
+
+typedef struct _scopeSample {
+  float setpoint;
+  float measurement;
+  float output;
+  bool start;
+  // Where the move starts and ends, for the scale, on the first sample
+  float from;
+  float to;
+} scopeSample;
+
+// About 4 seconds of 15 msec iterations if the screen falls behind
+spscRing<scopeSample, 256> scopeRing;
+// Only the control task touches these
+bool scopeNewMove = false;
+float scopeFrom = 0;
+float scopeTo = 0;
+
+void scopeStart(double start, double target) {
+  scopeFrom = start;
+  scopeTo = target;
+  scopeNewMove = true;
+}
+
+void scopePush(double setpoint, double measurement, double output) {
+  scopeSample sample = {(float)setpoint, (float)measurement, (float)output,
+                        scopeNewMove, scopeFrom, scopeTo};
+  if (scopeRing.push(sample))
+    scopeNewMove = false;
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Plot layout. Top pane setpoint/measurement, bottom pane volts */
+/*-----------------------------------------------------------------------------*/
+
+const int plotWidth = 480;
+const int topPane = pageTabHeight + 16;
+const int topHeight = 130;
+const int bottomPane = topPane + topHeight + 4;
+const int bottomHeight = 240 - bottomPane;
+const double outputRange = 12;
+
+// Columns cleared ahead of the sweep so the newest data stands out
+const int sweepGap = 4;
+
+int column = 0;
+// Scale of the top pane, set from the first sample of each move
+double scaleMin = 0;
+double scaleMax = 1;
+// Pixel rows of the last column drawn, -1 when nothing drawn yet
+int lastSetpoint = -1;
+int lastMeasurement = -1;
+int lastOutput = -1;
+
+static int topRow(double value) {
+  double fraction = (value - scaleMin) / (scaleMax - scaleMin);
+  if (fraction < 0)
+    fraction = 0;
+  if (fraction > 1)
+    fraction = 1;
+  return topPane + topHeight - 1 - (int)(fraction * (topHeight - 1));
+}
+
+static int bottomRow(double volts) {
+  double fraction = (volts + outputRange) / (2 * outputRange);
+  if (fraction < 0)
+    fraction = 0;
+  if (fraction > 1)
+    fraction = 1;
+  return bottomPane + bottomHeight - 1 - (int)(fraction * (bottomHeight - 1));
+}
+
+// Join the last point to this one inside a single column
+static void drawTrace(int &last, int row, const vex::color &c) {
+  Brain.Screen.setPenColor(c);
+  if (last < 0)
+    Brain.Screen.drawPixel(column, row);
+  else
+    Brain.Screen.drawLine(column, last, column, row);
+  last = row;
+}
+
+static void clearAhead(void) {
+  Brain.Screen.setPenColor(vex::color::black);
+  Brain.Screen.setFillColor(vex::color::black);
+  for (int gap = 1; gap <= sweepGap; gap++) {
+    int x = (column + gap) % plotWidth;
+    Brain.Screen.drawLine(x, topPane, x, topPane + topHeight - 1);
+    Brain.Screen.drawLine(x, bottomPane, x, bottomPane + bottomHeight - 1);
+  }
+  // Keep the 0 V line visible
+  Brain.Screen.setPenColor(vex::color(0x404040));
+  int zero = bottomRow(0);
+  Brain.Screen.drawLine((column + 1) % plotWidth, zero,
+                        (column + sweepGap) % plotWidth, zero);
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      One new column per sample, nothing else is redrawn */
+/*-----------------------------------------------------------------------------*/
+
+static void drawSample(const scopeSample &sample) {
+  if (sample.start) {
+    // New move, scale to where it starts and where it is going. A profile's
+    // first setpoint is the start, so it can't say where the move ends
+    double low = fmin(fmin(sample.from, sample.to), sample.measurement);
+    double high = fmax(fmax(sample.from, sample.to), sample.measurement);
+    double margin = (high - low) * 0.1 + 1;
+    scaleMin = low - margin;
+    scaleMax = high + margin;
+    column = 0;
+    lastSetpoint = lastMeasurement = lastOutput = -1;
+
+    Brain.Screen.setFont(fontType::mono12);
+    Brain.Screen.setPenColor(vex::color(0xe0e0e0));
+    Brain.Screen.setFillColor(vex::color::black);
+    Brain.Screen.printAt(4, topPane - 4, "%8.1f .. %-8.1f", scaleMin, scaleMax);
+    Brain.Screen.setPenColor(vex::color(0xe0c000));
+    Brain.Screen.printAt(200, topPane - 4, "setpoint");
+    Brain.Screen.setPenColor(vex::color(0x00c000));
+    Brain.Screen.printAt(280, topPane - 4, "measured");
+    Brain.Screen.setPenColor(vex::color(0x00a0e0));
+    Brain.Screen.printAt(360, topPane - 4, "volts");
+  }
+
+  drawTrace(lastSetpoint, topRow(sample.setpoint), vex::color(0xe0c000));
+  drawTrace(lastMeasurement, topRow(sample.measurement), vex::color(0x00c000));
+  drawTrace(lastOutput, bottomRow(sample.output), vex::color(0x00a0e0));
+  clearAhead();
+
+  column += 1;
+  if (column >= plotWidth) {
+    column = 0;
+    lastSetpoint = lastMeasurement = lastOutput = -1;
+  }
+}
+
+int scopePage = -1;
+
+static void drawScope(bool full) {
+  if (full) {
+    Brain.Screen.setPenColor(vex::color(0x404040));
+    Brain.Screen.drawLine(0, bottomPane - 2, plotWidth - 1, bottomPane - 2);
+    column = 0;
+    lastSetpoint = lastMeasurement = lastOutput = -1;
+  }
+}
+
+void scopeUpdate(void) {
+  // Always drain so the page shows live data as soon as it comes up
+  bool visible = pageCurrent() == scopePage;
+
+  scopeSample sample;
+  while (scopeRing.pop(sample)) {
+    if (visible)
+      drawSample(sample);
+  }
+}
+
+void scopeInit(void) {
+  brainPage page = {"Scope", drawScope, NULL};
+  scopePage = pageAdd(page);
+}
@@ -20,6 +20,9 @@ motor LiftA = motor(PORT8, ratio36_1, true);
 motor_group Lift =  motor_group(LiftA, LiftB);
 controller Controller2 = controller(partner);
 inertial TurnGyroSmart = inertial(PORT12);
+motor_group LeftDriveSmart = motor_group(FrontLeft, BackLeft);
+motor_group RightDriveSmart = motor_group(FrontRight, BackRight);
+smartdrive Drivetrain = smartdrive(LeftDriveSmart, RightDriveSmart, TurnGyroSmart, 319.19, 320, 40, mm, 1);
 
 // VEXcode generated functions
 // define variable for remote controller enable/disable
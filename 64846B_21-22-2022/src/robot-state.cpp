@@ -0,0 +1,34 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       robot-state.cpp                                           */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Robot state snapshot shared between tasks                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "robot-state.h"
+
+seqlock<robotState> sharedState;
+seqlock<moveReport> sharedMoveReport;
+
+void robotStatePublish(const robotState &state) { sharedState.write(state); }
+
+void robotStateRead(robotState &state) { sharedState.read(state); }
+
+void robotStateReadFresh(robotState &state) {
+  sharedState.read(state);
+  // The next sample may have been started before we were called, the one
+  // after it is guaranteed not to have been
+  uint32_t wanted = state.sample + 2;
+  while ((int32_t)(state.sample - wanted) < 0) {
+    this_thread::sleep_for(5);
+    sharedState.read(state);
+  }
+}
+
+void moveReportPublish(const moveReport &report) {
+  sharedMoveReport.write(report);
+}
+
+void moveReportRead(moveReport &report) { sharedMoveReport.read(report); }
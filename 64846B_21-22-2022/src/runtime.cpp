@@ -0,0 +1,154 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       runtime.cpp                                               */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Background tasks, their priorities and rates              */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "runtime.h"
+#include "auton-runner.h"
+#include "battery-comp.h"
+#include "brain-pages.h"
+#include "input-log.h"
+#include "loop-timing.h"
+#include "motor-health.h"
+#include "odometry.h"
+#include "pid-scope.h"
+#include "robot-state.h"
+#include "traction.h"
+
+extern competition Competition;
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Sample every sensor once and publish the snapshot */
+/*-----------------------------------------------------------------------------*/
+
+int sensorTask() {
+  robotState state;
+  state.sample = 0;
+
+  while (true) {
+    uint32_t start = timer::system();
+    scopedTimer sampleTimer(sensorTiming);
+
+    state.sample += 1;
+    state.time = start;
+    state.rotation = TurnGyroSmart.rotation(degrees);
+    state.heading = TurnGyroSmart.heading(degrees);
+    state.leftPosition = FrontLeft.position(degrees);
+    state.rightPosition = FrontRight.position(degrees);
+    state.leftVelocity = LeftDriveSmart.velocity(velocityUnits::pct);
+    state.rightVelocity = RightDriveSmart.velocity(velocityUnits::pct);
+    state.leftCurrent = LeftDriveSmart.current(amp);
+    state.rightCurrent = RightDriveSmart.current(amp);
+    state.accelX = TurnGyroSmart.acceleration(xaxis);
+    state.accelY = TurnGyroSmart.acceleration(yaxis);
+    state.liftPosition = Lift.position(degrees);
+    state.clawPosition = Claw.position(degrees);
+    state.backPosition = Back.position(degrees);
+    state.backCurrent = Back.current(amp);
+    state.batteryVoltage = batteryUpdate();
+    odometryUpdate(state);
+    tractionUpdate(state);
+
+    robotStatePublish(state);
+    sampleTimer.stop();
+
+    // Keep a fixed rate no matter how long the reads took
+    uint32_t elapsed = timer::system() - start;
+    this_thread::sleep_for(elapsed < sensorPeriod ? sensorPeriod - elapsed : 1);
+  }
+  return 0;
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Screens. Slow controller writes live here, not in the loops */
+/*-----------------------------------------------------------------------------*/
+
+int uiTask() {
+  int shownReport = 0;
+  int shownWarning = 0;
+  bool wasEnabled = false;
+  bool wasAutonomous = false;
+
+  while (true) {
+    // Battery stats for each enabled period of a match, and the step
+    // timing once autonomous is over
+    bool enabled = Competition.isEnabled();
+    if (enabled != wasEnabled) {
+      if (enabled) {
+        batteryStatsReset();
+        tractionStatsReset();
+      } else {
+        batteryStatsLog(wasAutonomous ? "autonomous" : "driver");
+        tractionStatsLog(wasAutonomous ? "autonomous" : "driver");
+        if (wasAutonomous)
+          autonReportLog();
+      }
+      wasEnabled = enabled;
+    }
+    if (enabled)
+      wasAutonomous = Competition.isAutonomous();
+
+    // Tuning data from the last turnPID/driveTo
+    moveReport report;
+    moveReportRead(report);
+    if (report.count != shownReport) {
+      shownReport = report.count;
+      Controller1.Screen.clearScreen();
+      Controller1.Screen.setCursor(1, 1);
+      if (report.turnCount > 0) {
+        Controller1.Screen.print("Turn #: %d", report.turnCount);
+        Controller1.Screen.setCursor(1, 13);
+        Controller1.Screen.print("iter: %.0f", report.iter);
+      }
+      Controller1.Screen.newLine();
+      Controller1.Screen.print("error: %.5f", report.error);
+      Controller1.Screen.newLine();
+      Controller1.Screen.print("derivative: %.5f", report.derivative);
+      Controller1.Screen.newLine();
+    }
+
+    // Hot motor warnings take the bottom line
+    healthMessage warning;
+    healthWarningRead(warning);
+    if (warning.count != shownWarning) {
+      shownWarning = warning.count;
+      Controller1.Screen.setCursor(3, 1);
+      Controller1.Screen.clearLine();
+      Controller1.Screen.print("%s", warning.text);
+    }
+
+    // Whatever page is up on the Brain screen
+    pageDraw();
+    scopeUpdate();
+
+    // SD card writes are slow, keep them out of the driver loop
+    inputLogService();
+
+    this_thread::sleep_for(uiPeriod);
+  }
+  return 0;
+}
+
+void runtimeInit(void) {
+  static task sensors = task(sensorTask, sensorPriority);
+  static task ui = task(uiTask, uiPriority);
+
+  // Don't let anything read before the first sample exists
+  robotState state;
+  robotStateReadFresh(state);
+}
+
+void runtimeControlThread(void) { this_thread::set_priority(controlPriority); }
+
+void runtimeSleepUntil(uint32_t &next, uint32_t period) {
+  next += period;
+  uint32_t now = timer::system();
+  if ((int32_t)(next - now) > 0)
+    this_thread::sleep_for(next - now);
+  else
+    next = now;
+}
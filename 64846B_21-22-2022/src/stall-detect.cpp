@@ -0,0 +1,126 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       stall-detect.cpp                                          */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Stall/collision detection for drive moves                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "stall-detect.h"
+#include "drive-geometry.h"
+#include "traction.h"
+
+// Ignore the start of a move, the drive is slow and draws current while it
+// gets going
+uint32_t stallGrace = 300;
+// Blocked this long (msec) is a stall, shorter after a collision
+uint32_t stallWindow = 250;
+uint32_t collisionWindow = 100;
+
+// Only look for stalls when asking for at least this much speed (percent)
+double stallMinCommand = 10;
+// Blocked when moving slower than this fraction of the command...
+double stallVelocityRatio = 0.25;
+// ...while a side draws more than this (amps, both motors together)
+double stallCurrent = 3.0;
+// A horizontal acceleration spike bigger than this (g) is a collision
+double collisionAccel = 0.6;
+
+void stallStart(stallDetector &detector) {
+  detector.start = timer::system();
+  detector.blockedSince = 0;
+  detector.collision = false;
+}
+
+bool stallCheck(stallDetector &detector, const robotState &state,
+                double commanded) {
+  uint32_t now = state.time;
+  // Signed, the sample can be from just before stallStart
+  int32_t elapsed = (int32_t)(now - detector.start);
+  if (elapsed < (int32_t)stallGrace || fabs(commanded) < stallMinCommand) {
+    detector.blockedSince = 0;
+    detector.collision = false;
+    return false;
+  }
+
+  double speed = (fabs(state.leftVelocity) + fabs(state.rightVelocity)) / 2;
+  double current = fmax(state.leftCurrent, state.rightCurrent);
+  double accel = sqrt(state.accelX * state.accelX + state.accelY * state.accelY);
+
+  bool slow = speed < fabs(commanded) * stallVelocityRatio;
+  bool blocked = slow && current > stallCurrent;
+  if (accel > collisionAccel && detector.blockedSince == 0)
+    detector.collision = true;
+
+  if (!blocked && !(slow && detector.collision)) {
+    detector.blockedSince = 0;
+    detector.collision = false;
+    return false;
+  }
+
+  if (detector.blockedSince == 0)
+    detector.blockedSince = now;
+
+  uint32_t window = detector.collision ? collisionWindow : stallWindow;
+  if (now - detector.blockedSince < window)
+    return false;
+
+  printf("stall: %s after %lu ms, %.0f%% of %.0f%% speed, %.1f A\n",
+         detector.collision ? "collision" : "blocked",
+         (unsigned long)(now - detector.start), speed, fabs(commanded),
+         current);
+  return true;
+}
+
+// 18:1 drive, 200 rpm (1200 dps) is 100%
+static double commandPercent(double velocity, velocityUnits unitsV) {
+  if (unitsV == velocityUnits::pct)
+    return velocity;
+  if (unitsV == velocityUnits::dps)
+    return velocity / 6 / 2;
+  return velocity / 2;
+}
+
+moveResult driveChecked(directionType dir, double distance,
+                        distanceUnits units, double velocity,
+                        velocityUnits unitsV, uint32_t timeout) {
+  if (timeout == 0) {
+    // Twice the time at the commanded speed (~42 in/s at 100%), plus 1 s
+    double inches = units == distanceUnits::mm ? distance / 25.4 : distance;
+    double inchesPerSec = 42 * fmax(commandPercent(velocity, unitsV), 5) / 100;
+    timeout = 1000 + (uint32_t)(2000 * fabs(inches) / inchesPerSec);
+  }
+
+  stallDetector detector;
+  stallStart(detector);
+  Drivetrain.driveFor(dir, distance * geometryDriveScale(), units, velocity,
+                      unitsV, false);
+
+  // Wheel slip cuts each side's torque while the move runs
+  robotState state;
+  moveResult result;
+  while (true) {
+    this_thread::sleep_for(10);
+    if (Drivetrain.isDone()) {
+      result = moveDone;
+      break;
+    }
+
+    robotStateRead(state);
+    tractionApply(state);
+    if (stallCheck(detector, state, commandPercent(velocity, unitsV))) {
+      Drivetrain.stop(brake);
+      result = moveStalled;
+      break;
+    }
+    if (timer::system() - detector.start > timeout) {
+      printf("drive: timed out after %lu ms\n", (unsigned long)timeout);
+      Drivetrain.stop(brake);
+      result = moveTimeout;
+      break;
+    }
+  }
+  tractionRelease();
+  return result;
+}
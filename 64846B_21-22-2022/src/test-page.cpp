@@ -0,0 +1,87 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       test-page.cpp                                             */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Brain screen page that runs tests/benchmarks on the robot */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <atomic>
+
+#include "test-page.h"
+#include "brain-pages.h"
+
+typedef struct _robotTest {
+  const char *name;
+  void (*run)(void);
+} robotTest;
+
+const int maxTests = 12;
+robotTest tests[maxTests];
+int testCount = 0;
+
+// Index of the queued test, -1 when nothing is queued
+std::atomic<int> testQueued(-1);
+std::atomic<bool> testRunning(false);
+
+// 3 columns of buttons
+const int testWidth = 150;
+const int testHeight = 44;
+const int testTop = pageTabHeight + 10;
+
+void testAdd(const char *name, void (*run)(void)) {
+  if (testCount < maxTests) {
+    robotTest test = {name, run};
+    tests[testCount++] = test;
+  }
+}
+
+static void drawTests(bool full) {
+  if (!full)
+    return;
+
+  Brain.Screen.setFont(fontType::mono20);
+  for (int i = 0; i < testCount; i++) {
+    int x = 8 + (i % 3) * (testWidth + 8);
+    int y = testTop + (i / 3) * (testHeight + 8);
+    Brain.Screen.setPenColor(vex::color(0xe0e0e0));
+    Brain.Screen.setFillColor(i == testQueued ? vex::color(0x00a000)
+                                              : vex::color(0x303030));
+    Brain.Screen.drawRectangle(x, y, testWidth, testHeight);
+    Brain.Screen.printAt(x + 8, y + 28, tests[i].name);
+  }
+  Brain.Screen.setFillColor(vex::color::black);
+  Brain.Screen.printAt(8, 230, "Runs from driver control, off the field");
+}
+
+static void touchTests(int xpos, int ypos, bool pressed) {
+  if (pressed || testRunning)
+    return;
+
+  int column = (xpos - 8) / (testWidth + 8);
+  int row = (ypos - testTop) / (testHeight + 8);
+  int index = row * 3 + column;
+  if (ypos < testTop || column > 2 || index >= testCount)
+    return;
+
+  // Touch a queued test again to cancel it
+  testQueued = testQueued == index ? -1 : index;
+  drawTests(true);
+}
+
+void testInit(void) {
+  brainPage page = {"Tests", drawTests, touchTests};
+  pageAdd(page);
+}
+
+void testPoll(void) {
+  int index = testQueued;
+  if (index < 0)
+    return;
+
+  testRunning = true;
+  tests[index].run();
+  testQueued = -1;
+  testRunning = false;
+}
@@ -0,0 +1,239 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       traction.cpp                                              */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Wheel slip from the encoders against the inertial         */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <atomic>
+
+#include "traction.h"
+#include "drive-geometry.h"
+
+double tractionSlip = 8;
+double tractionMinTorque = 60;
+bool tractionEnabled = true;
+
+// Inertial y is forward on this robot, -1 if it's ever mounted backwards
+double tractionAccelSign = 1;
+
+// Per 10 msec sample:
+//    - encoder velocity low pass, the deltas are only a few degrees
+//    - how fast the inertial velocity is pulled to the encoders while the
+//      wheels grip, so it doesn't drift
+//    - how fast the accel bias (tilt on the platform) is learned while
+//      the wheels grip
+//    - torque cut while slipping and given back while gripping, percent
+const double velocityFilter = 0.5;
+const double gripLeak = 0.05;
+const double biasGain = 0.02;
+const double cutRate = 10;
+const double recoverRate = 2;
+
+// A slip longer than this (msec) is the inertial estimate drifting, not the
+// wheels, start it again from the encoders
+const uint32_t maxSlip = 500;
+
+const double gravity = 386.09; // in/s^2
+
+// Only the sensor task touches these
+static bool started = false;
+static uint32_t lastTime = 0;
+static double lastLeft = 0;
+static double lastRight = 0;
+static double lastRotation = 0;
+static double leftVelocity = 0;
+static double rightVelocity = 0;
+static double lastChassis = 0;
+static double encoderAccel = 0;
+static double imuVelocity = 0;
+static double accelBias = 0;
+static double leftTorque = 100;
+static double rightTorque = 100;
+static bool leftSlipping = false;
+static bool rightSlipping = false;
+static uint32_t slipSince = 0;
+static uint32_t slipCount = 0;
+
+typedef struct _tractionStats {
+  uint32_t startTime;
+  uint32_t leftEvents;
+  uint32_t rightEvents;
+  // msec with either side slipping
+  uint32_t slipTime;
+  double worstSlip;
+  double lowestTorque;
+} tractionStats;
+
+static tractionStats stats;
+static seqlock<tractionStats> sharedStats;
+static std::atomic<bool> statsResetRequested(true);
+
+// Torque last set on each side, only the driving task touches these
+static double appliedLeft = 100;
+static double appliedRight = 100;
+
+// Hysteresis: slipping past tractionSlip, gripping again under half of it
+static bool slipState(bool slipping, double slip) {
+  if (slipping)
+    return fabs(slip) > tractionSlip / 2;
+  return fabs(slip) > tractionSlip;
+}
+
+static double step(double torque, bool slipping) {
+  torque += slipping ? -cutRate : recoverRate;
+  if (torque < tractionMinTorque)
+    return tractionMinTorque;
+  if (torque > 100)
+    return 100;
+  return torque;
+}
+
+void tractionUpdate(robotState &state) {
+  if (!started || state.time == lastTime) {
+    lastTime = state.time;
+    lastLeft = state.leftPosition;
+    lastRight = state.rightPosition;
+    lastRotation = state.rotation;
+    started = true;
+  }
+  double dt = (state.time - lastTime) / 1000.0;
+
+  if (statsResetRequested.exchange(false)) {
+    stats.startTime = state.time;
+    stats.leftEvents = 0;
+    stats.rightEvents = 0;
+    stats.slipTime = 0;
+    stats.worstSlip = 0;
+    stats.lowestTorque = 100;
+  }
+
+  if (dt > 0) {
+    // Each side from its encoder, in/s
+    double left = geometryInches(state.leftPosition - lastLeft) / dt;
+    double right = geometryInches(state.rightPosition - lastRight) / dt;
+    leftVelocity += (left - leftVelocity) * velocityFilter;
+    rightVelocity += (right - rightVelocity) * velocityFilter;
+    double chassis = (leftVelocity + rightVelocity) / 2;
+    encoderAccel += ((chassis - lastChassis) / dt - encoderAccel) * velocityFilter;
+    lastChassis = chassis;
+
+    // Clockwise turn rate from the inertial, each side's share of it
+    double omega = (state.rotation - lastRotation) * 3.14159265358979 / 180 / dt;
+    double turn = omega * geometry.trackWidth / 2;
+
+    // Chassis velocity from the inertial. While both sides grip it follows
+    // the encoders slowly and learns the bias, while slipping it's on its own
+    double accel = tractionAccelSign * state.accelY * gravity;
+    bool slipping = leftSlipping || rightSlipping;
+    if (!slipping)
+      accelBias += (accel - encoderAccel - accelBias) * biasGain;
+    imuVelocity += (accel - accelBias) * dt;
+    if (!slipping)
+      imuVelocity += (chassis - imuVelocity) * gripLeak;
+
+    state.leftSlip = leftVelocity - (imuVelocity + turn);
+    state.rightSlip = rightVelocity - (imuVelocity - turn);
+
+    bool left0 = leftSlipping;
+    bool right0 = rightSlipping;
+    leftSlipping = slipState(leftSlipping, state.leftSlip);
+    rightSlipping = slipState(rightSlipping, state.rightSlip);
+
+    if (leftSlipping && !left0) {
+      slipCount += 1;
+      stats.leftEvents += 1;
+    }
+    if (rightSlipping && !right0) {
+      slipCount += 1;
+      stats.rightEvents += 1;
+    }
+
+    if (leftSlipping || rightSlipping) {
+      if (!slipping)
+        slipSince = state.time;
+      stats.slipTime += state.time - lastTime;
+      // Stuck on, it's the estimate that's wrong
+      if (state.time - slipSince > maxSlip) {
+        imuVelocity = chassis;
+        leftSlipping = false;
+        rightSlipping = false;
+      }
+    }
+    double worst = fmax(fabs(state.leftSlip), fabs(state.rightSlip));
+    if (worst > stats.worstSlip)
+      stats.worstSlip = worst;
+  } else {
+    state.leftSlip = 0;
+    state.rightSlip = 0;
+  }
+
+  leftTorque = step(leftTorque, leftSlipping);
+  rightTorque = step(rightTorque, rightSlipping);
+  if (fmin(leftTorque, rightTorque) < stats.lowestTorque)
+    stats.lowestTorque = fmin(leftTorque, rightTorque);
+  sharedStats.write(stats);
+
+  lastTime = state.time;
+  lastLeft = state.leftPosition;
+  lastRight = state.rightPosition;
+  lastRotation = state.rotation;
+
+  state.imuVelocity = imuVelocity;
+  state.leftTorque = leftTorque;
+  state.rightTorque = rightTorque;
+  state.slipCount = slipCount;
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Drive side torque, from the loop that's driving */
+/*-----------------------------------------------------------------------------*/
+
+void tractionApply(const robotState &state) {
+  double left = tractionEnabled ? state.leftTorque : 100;
+  double right = tractionEnabled ? state.rightTorque : 100;
+
+  // setMaxTorque goes out to both motors, skip it when nothing changed
+  if (fabs(left - appliedLeft) >= 1) {
+    LeftDriveSmart.setMaxTorque(left, percentUnits::pct);
+    appliedLeft = left;
+  }
+  if (fabs(right - appliedRight) >= 1) {
+    RightDriveSmart.setMaxTorque(right, percentUnits::pct);
+    appliedRight = right;
+  }
+}
+
+void tractionRelease(void) {
+  LeftDriveSmart.setMaxTorque(100, percentUnits::pct);
+  RightDriveSmart.setMaxTorque(100, percentUnits::pct);
+  appliedLeft = 100;
+  appliedRight = 100;
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Slip events for a match period */
+/*-----------------------------------------------------------------------------*/
+
+void tractionStatsReset(void) { statsResetRequested = true; }
+
+void tractionStatsLog(const char *period) {
+  tractionStats s;
+  sharedStats.read(s);
+
+  char line[96];
+  int length = snprintf(line, sizeof(line), "%s,%lu,%lu,%lu,%lu,%.1f,%.0f\n",
+                        period,
+                        (unsigned long)(timer::system() - s.startTime) / 1000,
+                        (unsigned long)s.leftEvents,
+                        (unsigned long)s.rightEvents,
+                        (unsigned long)s.slipTime, s.worstSlip,
+                        s.lowestTorque);
+
+  // period,seconds,left events,right events,slip ms,worst in/s,lowest torque %
+  printf("traction: %s", line);
+  if (Brain.SDcard.isInserted())
+    Brain.SDcard.appendfile("traction.csv", (uint8_t *)line, length);
+}
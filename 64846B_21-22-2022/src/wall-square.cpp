@@ -0,0 +1,90 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       wall-square.cpp                                           */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Square against a wall and relocalize from it              */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "wall-square.h"
+#include "battery-comp.h"
+#include "odometry.h"
+#include "robot-state.h"
+
+// Push gently, hard enough to turn the robot flat but not to climb
+double squareVolts = 4;
+// A side is against the wall when it's this slow (percent) while drawing
+// this much current (amps, both motors)
+double squareVelocity = 5;
+double squareCurrent = 1.5;
+// Ignore the start, and both sides have to stay blocked this long (msec)
+uint32_t squareGrace = 300;
+uint32_t squareWindow = 200;
+
+static bool sideBlocked(double velocity, double current) {
+  return fabs(velocity) < squareVelocity && current > squareCurrent;
+}
+
+squareResult squareToWall(directionType dir, double wallRotation,
+                          poseAxis axis, double axisValue, uint32_t timeout) {
+  squareResult result = {false, 0, 0};
+  double volts = batteryCompensate(dir == directionType::fwd ? squareVolts
+                                                             : -squareVolts);
+
+  // Both sides keep pushing. Whichever side touches first stops and the
+  // other pivots the robot around it until it's flat
+  LeftDriveSmart.spin(forward, volts, voltageUnits::volt);
+  RightDriveSmart.spin(forward, volts, voltageUnits::volt);
+
+  uint32_t start = timer::system();
+  uint32_t blockedSince = 0;
+  robotState state;
+  while (timer::system() - start < timeout) {
+    this_thread::sleep_for(10);
+    robotStateRead(state);
+    if (state.time - start < squareGrace)
+      continue;
+
+    if (sideBlocked(state.leftVelocity, state.leftCurrent) &&
+        sideBlocked(state.rightVelocity, state.rightCurrent)) {
+      if (blockedSince == 0)
+        blockedSince = state.time;
+      if (state.time - blockedSince >= squareWindow) {
+        result.squared = true;
+        break;
+      }
+    } else {
+      blockedSince = 0;
+    }
+  }
+
+  LeftDriveSmart.stop(brake);
+  RightDriveSmart.stop(brake);
+  if (!result.squared) {
+    printf("square: not flat after %lu ms, nothing reset\n",
+           (unsigned long)timeout);
+    return result;
+  }
+
+  // Same wall whichever way round we've turned so far
+  double turns = round((state.rotation - wallRotation) / 360);
+  double rotation = wallRotation + turns * 360;
+  result.headingCorrection = rotation - state.rotation;
+  TurnGyroSmart.setRotation(rotation, degrees);
+  TurnGyroSmart.setHeading(rotation - 360 * floor(rotation / 360), degrees);
+
+  if (axis == axisX) {
+    result.poseCorrection = axisValue - state.x;
+    odometrySetX(axisValue);
+  } else if (axis == axisY) {
+    result.poseCorrection = axisValue - state.y;
+    odometrySetY(axisValue);
+  }
+
+  printf("square: heading %+.2f deg, %s %+.2f in, %lu ms\n",
+         result.headingCorrection,
+         axis == axisX ? "x" : (axis == axisY ? "y" : "no axis"),
+         result.poseCorrection, (unsigned long)(state.time - start));
+  return result;
+}
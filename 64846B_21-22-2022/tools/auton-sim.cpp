@@ -0,0 +1,354 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       auton-sim.cpp                                             */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Monte Carlo runs of the autonomous step tables            */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+// Runs every routine in auton-routines.h thousands of times against a
+// simple chassis model with a random start, wheel slip, side mismatch,
+// gyro drift and battery, on every core. Step times come from step-time.h,
+// the model auton-time plans with. Build with the makefile in this
+// folder:
+//    make auton-sim
+//    ./auton-sim [runs per routine] [routine name] [seed]
+//
+// A run fails when the robot ends a step more than posTolerance inches or
+// headingTolerance degrees from where a perfect run is at the same step,
+// or when a required step doesn't get run before the buzzer. The step
+// where that first happens gets the blame.
+
+#include <algorithm>
+#include <math.h>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#include "auton-routines.h"
+#include "drive-geometry.h"
+#include "step-time.h"
+
+// Same as the robot
+const uint32_t minStep = stepMinTime;
+const double trackWidth = configuredGeometry.trackWidth;
+const double wheelTravel = configuredGeometry.wheelTravel;
+const double batteryNominal = 12.8;
+
+// Failure tolerances
+const double posTolerance = 4;
+const double headingTolerance = 6;
+
+const double pi = 3.14159265358979;
+
+// What one run draws at random
+typedef struct _runParams {
+  double startX, startY, startHeading;
+  // Fraction of distance lost at full speed
+  double slip;
+  // Right minus left speed as a fraction, turns the robot while driving
+  double mismatch;
+  // Gyro drift, deg/s
+  double drift;
+  double battery;
+  // Scales every step's time a little
+  double pace;
+} runParams;
+
+typedef struct _pose {
+  double x, y, heading;
+} pose;
+
+typedef struct _runResult {
+  bool success;
+  uint32_t time;
+  // Step blamed for a failure, -1 when it succeeded
+  int failedStep;
+  bool overran;
+} runResult;
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Chassis model, one step at a time */
+/*-----------------------------------------------------------------------------*/
+
+typedef struct _simState {
+  pose robot;
+  // Gyro reading minus true heading
+  double gyroError;
+  uint32_t time;
+} simState;
+
+static void moveStraight(simState &sim, double inches) {
+  double radians = sim.robot.heading * pi / 180;
+  sim.robot.x += inches * sin(radians);
+  sim.robot.y += inches * cos(radians);
+}
+
+// Top speed in percent, velocity mode can't ask for more volts than the
+// battery has
+static double speedLimit(const runParams &p, double velocity) {
+  return std::min(velocity, 100 * p.battery / batteryNominal);
+}
+
+// Runs one step, returns msec taken (0 for steps that don't wait)
+static uint32_t simStep(simState &sim, const autonStep &step,
+                        const runParams &p, uint32_t timeout) {
+  // Time from the same model auton-time plans with, at the speed the
+  // battery allows and with the run's pace on top
+  autonStep limited = step;
+  limited.velocity = speedLimit(p, step.velocity);
+  double rotation = sim.robot.heading + sim.gyroError;
+  double t = stepMotionTime(limited, rotation) * 1000 * p.pace;
+  double done = 1;
+  if (t > timeout) {
+    done = timeout / t;
+    t = timeout;
+  }
+
+  switch (step.kind) {
+  case stepDrive:
+  case stepDriveRetry:
+  case stepDriveTo: {
+    bool pid = step.kind == stepDriveTo;
+    double inches = pid ? step.amount * 12 : step.amount;
+    double velocity = pid ? 70 : step.velocity;
+    // A move that doesn't wait isn't cut short
+    if (!step.wait)
+      done = 1;
+    // Encoders count the slip as distance, driveTo's PID less so
+    double slip = p.slip * velocity / 100 * (pid ? 0.5 : 1);
+    double actual = inches * done * (1 - slip);
+    // Smartdrive doesn't hold heading, so a mismatch turns it as it goes
+    double turn = p.mismatch * fabs(actual) / trackWidth * 180 / pi;
+    sim.robot.heading += turn / 2;
+    moveStraight(sim, actual);
+    sim.robot.heading += turn / 2;
+    break;
+  }
+  case stepTurn: {
+    // turnPID settles on the gyro, so the true heading is off by its error
+    double measured = sim.robot.heading + sim.gyroError;
+    sim.robot.heading += (step.amount - measured) * done;
+    break;
+  }
+  case stepRightSide: {
+    // Pivot on the left side
+    double arc = step.amount / 360 * wheelTravel * (1 - p.slip);
+    double radians = arc / trackWidth * done;
+    double half = trackWidth / 2;
+    double h = sim.robot.heading * pi / 180;
+    // Left wheel stays put, center swings around it
+    double pivotX = sim.robot.x - half * cos(h);
+    double pivotY = sim.robot.y + half * sin(h);
+    h -= radians;
+    sim.robot.heading = h * 180 / pi;
+    sim.robot.x = pivotX + half * cos(h);
+    sim.robot.y = pivotY - half * sin(h);
+    break;
+  }
+  case stepBack:
+  case stepClaw:
+  case stepLift:
+    break;
+  case stepWait:
+    // The clock doesn't run at the robot's pace
+    t = std::min<double>(step.amount, timeout);
+    break;
+  case stepReplay:
+    t = timeout;
+    break;
+  case stepSquare: {
+    // Flat against the wall, wherever the plan has it. The gyro is set to
+    // the wall rotation, so its error is gone too
+    double measured = sim.robot.heading + sim.gyroError;
+    double heading = step.amount + 360 * round((sim.robot.heading - step.amount) / 360);
+    double reset = step.amount + 360 * round((measured - step.amount) / 360);
+    if (done == 1) {
+      sim.robot.heading = heading;
+      sim.gyroError = reset - heading;
+      if (step.axis == stepAxisX)
+        sim.robot.x = step.axisValue;
+      else if (step.axis == stepAxisY)
+        sim.robot.y = step.axisValue;
+    }
+    break;
+  }
+  }
+
+  uint32_t taken = step.wait ? (uint32_t)t : 0;
+  sim.gyroError += p.drift * taken / 1000;
+  return taken;
+}
+
+// Runs a routine, poses is filled with where it ended each step
+static runResult simRoutine(const autonRoutine &routine, const runParams &p,
+                            pose *poses) {
+  // The gyro was zeroed wherever the robot sat when it calibrated and
+  // turnPID turns to absolute rotations, so a start heading error stays
+  simState sim = {{p.startX, p.startY, p.startHeading}, -p.startHeading, 0};
+  runResult result = {true, 0, -1, false};
+
+  for (int i = 0; i < routine.count; i++) {
+    int32_t left = (int32_t)routine.matchLength - (int32_t)sim.time;
+    if (stepSkip(routine, i, left, minStep)) {
+      if (routine.steps[i].priority == stepRequired && result.failedStep < 0) {
+        result.failedStep = i;
+        result.overran = true;
+      }
+      poses[i] = sim.robot;
+      continue;
+    }
+    sim.time += simStep(sim, routine.steps[i], p, stepTimeout(routine.steps[i], left));
+    poses[i] = sim.robot;
+  }
+
+  result.time = sim.time;
+  result.success = result.failedStep < 0;
+  return result;
+}
+
+static double headingDiff(double a, double b) {
+  double d = fmod(a - b, 360);
+  if (d > 180)
+    d -= 360;
+  if (d < -180)
+    d += 360;
+  return fabs(d);
+}
+
+/*-----------------------------------------------------------------------------*/
+/** @brief      Many runs of one routine, split across threads */
+/*-----------------------------------------------------------------------------*/
+
+typedef struct _sweep {
+  std::vector<uint32_t> times;
+  std::vector<int> failures;
+  int successes;
+  int overruns;
+} sweep;
+
+static void runBatch(const autonRoutine &routine, const pose *nominal,
+                     int runs, uint32_t seed, sweep &out) {
+  std::mt19937 rng(seed);
+  std::normal_distribution<double> start(0, 1);
+  std::normal_distribution<double> startHeading(0, 1.5);
+  std::uniform_real_distribution<double> slip(0, 0.06);
+  std::normal_distribution<double> mismatch(0, 0.015);
+  std::uniform_real_distribution<double> drift(-0.05, 0.05);
+  std::uniform_real_distribution<double> battery(11.6, 12.9);
+  std::uniform_real_distribution<double> pace(0.95, 1.2);
+
+  std::vector<pose> poses(routine.count);
+  out.failures.assign(routine.count, 0);
+  out.successes = 0;
+  out.overruns = 0;
+
+  for (int run = 0; run < runs; run++) {
+    runParams p = {start(rng),    start(rng),   startHeading(rng),
+                   slip(rng),     mismatch(rng), drift(rng),
+                   battery(rng),  pace(rng)};
+    runResult result = simRoutine(routine, p, poses.data());
+
+    // First step that ended too far from the perfect run
+    for (int i = 0; i < routine.count; i++) {
+      if (result.failedStep >= 0 && i >= result.failedStep)
+        break;
+      double dx = poses[i].x - nominal[i].x;
+      double dy = poses[i].y - nominal[i].y;
+      if (sqrt(dx * dx + dy * dy) > posTolerance ||
+          headingDiff(poses[i].heading, nominal[i].heading) > headingTolerance) {
+        result.failedStep = i;
+        result.success = false;
+        break;
+      }
+    }
+
+    out.times.push_back(result.time);
+    if (result.success)
+      out.successes += 1;
+    else
+      out.failures[result.failedStep] += 1;
+    if (result.overran)
+      out.overruns += 1;
+  }
+}
+
+static void simulate(const autonRoutine &routine, int runs, uint32_t seed,
+                     unsigned threads) {
+  // The perfect run everything is measured against
+  runParams perfect = {0, 0, 0, 0, 0, 0, batteryNominal, 1};
+  std::vector<pose> nominal(routine.count);
+  runResult planned = simRoutine(routine, perfect, nominal.data());
+
+  std::vector<sweep> parts(threads);
+  std::vector<std::thread> workers;
+  for (unsigned i = 0; i < threads; i++) {
+    int share = runs / threads + (i < runs % threads ? 1 : 0);
+    workers.push_back(std::thread(runBatch, std::cref(routine),
+                                  nominal.data(), share, seed + i * 7919,
+                                  std::ref(parts[i])));
+  }
+  for (unsigned i = 0; i < threads; i++)
+    workers[i].join();
+
+  // Merge
+  sweep all;
+  all.failures.assign(routine.count, 0);
+  all.successes = 0;
+  all.overruns = 0;
+  for (unsigned i = 0; i < threads; i++) {
+    all.times.insert(all.times.end(), parts[i].times.begin(), parts[i].times.end());
+    for (int s = 0; s < routine.count; s++)
+      all.failures[s] += parts[i].failures[s];
+    all.successes += parts[i].successes;
+    all.overruns += parts[i].overruns;
+  }
+  std::sort(all.times.begin(), all.times.end());
+
+  int total = (int)all.times.size();
+  int worst = (int)(std::max_element(all.failures.begin(), all.failures.end()) -
+                    all.failures.begin());
+
+  printf("%-12s %5.1f%% ok  time p10 %5.2f p50 %5.2f p90 %5.2f max %5.2f s"
+         " (perfect %5.2f)  overran %d\n",
+         routine.name, 100.0 * all.successes / total,
+         all.times[total / 10] / 1000.0, all.times[total / 2] / 1000.0,
+         all.times[total * 9 / 10] / 1000.0, all.times[total - 1] / 1000.0,
+         planned.time / 1000.0, all.overruns);
+  if (all.failures[worst] > 0) {
+    const autonStep &step = routine.steps[worst];
+    printf("             worst step %d (%s %g): %.1f%% of runs fail there\n",
+           worst, stepKindNames[step.kind], step.amount,
+           100.0 * all.failures[worst] / total);
+  }
+}
+
+int main(int argc, char **argv) {
+  int runs = argc > 1 ? atoi(argv[1]) : 20000;
+  const char *only = argc > 2 ? argv[2] : NULL;
+  uint32_t seed = argc > 3 ? (uint32_t)atoi(argv[3]) : 1;
+  if (runs < 1) {
+    fprintf(stderr, "usage: %s [runs] [routine] [seed]\n", argv[0]);
+    return 1;
+  }
+
+  unsigned threads = std::thread::hardware_concurrency();
+  if (threads == 0)
+    threads = 4;
+  printf("%d runs per routine on %u threads\n", runs, threads);
+
+  for (int i = 0; i < autonRoutineCount; i++) {
+    const autonRoutine &routine = *autonRoutines[i];
+    // Replay depends on what was recorded, nothing to model
+    if (routine.steps[0].kind == stepReplay)
+      continue;
+    if (only != NULL && strcmp(only, routine.name) != 0)
+      continue;
+    simulate(routine, runs, seed + i * 104729, threads);
+  }
+  return 0;
+}
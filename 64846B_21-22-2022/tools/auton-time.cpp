@@ -0,0 +1,129 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       auton-time.cpp                                            */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Time estimate for each autonomous step table              */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+// Estimates every step with step-time.h (trapezoid profile from the
+// limits in motion-limits.h plus settle time), adds up each routine and
+// checks it against its match length and each step against its planned
+// time. Also points out where running a mechanism during the move next to
+// it would save the most. Build and check with the makefile in this
+// folder, or make check from the project folder:
+//    make check
+//    ./auton-time -v     (every step, not just the totals)
+//
+// Exits with 1 when a routine doesn't fit or a plan is off, so make check
+// fails. The est ms column of -v (rounded to 50) is what goes in the table.
+
+#include <algorithm>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "auton-routines.h"
+#include "step-time.h"
+
+// Fail planned times this far off the estimate, or 50 msec for short
+// steps since plans are rounded to it
+const double planTolerance = 0.25;
+const double planSlack = 0.05;
+
+static bool isMechanism(const autonStep &step) {
+  return step.kind == stepBack || step.kind == stepClaw ||
+         step.kind == stepLift;
+}
+
+static bool isChassis(const autonStep &step) {
+  return step.kind == stepDrive || step.kind == stepDriveRetry ||
+         step.kind == stepDriveTo || step.kind == stepTurn ||
+         step.kind == stepRightSide || step.kind == stepSquare;
+}
+
+typedef struct _overlap {
+  int mechanism;
+  int chassis;
+  double saving;
+} overlap;
+
+static bool estimate(const autonRoutine &routine, bool verbose) {
+  std::vector<double> motion(routine.count);
+  std::vector<double> blocking(routine.count);
+  double heading = 0;
+  double total = 0;
+  int offPlan = 0;
+
+  if (verbose)
+    printf("\n%s\n  step kind         amount   est ms  plan ms\n", routine.name);
+
+  for (int i = 0; i < routine.count; i++) {
+    const autonStep &step = routine.steps[i];
+    motion[i] = stepMotionTime(step, heading);
+    // Steps that don't wait only hold up the routine for the command
+    blocking[i] = step.wait ? motion[i] : 0;
+    total += blocking[i];
+
+    double planned = step.expected / 1000.0;
+    bool off = step.wait && blocking[i] > 0 &&
+               fabs(planned - blocking[i]) >
+                   std::max(blocking[i] * planTolerance, planSlack);
+    if (off)
+      offPlan += 1;
+    if (verbose)
+      printf("  %4d %-11s %7g %8.0f %8lu%s\n", i, stepKindNames[step.kind],
+             step.amount, round(blocking[i] * 1000 / 50) * 50,
+             (unsigned long)step.expected, off ? "  plan off" : "");
+  }
+
+  // A waiting mechanism step next to a chassis move could run during it
+  std::vector<overlap> overlaps;
+  for (int i = 0; i < routine.count; i++) {
+    const autonStep &step = routine.steps[i];
+    if (!isMechanism(step) || !step.wait)
+      continue;
+    for (int j = i - 1; j <= i + 1; j += 2) {
+      if (j < 0 || j >= routine.count || !isChassis(routine.steps[j]))
+        continue;
+      overlap o = {i, j, std::min(blocking[i], blocking[j])};
+      overlaps.push_back(o);
+    }
+  }
+  std::sort(overlaps.begin(), overlaps.end(),
+            [](const overlap &a, const overlap &b) { return a.saving > b.saving; });
+
+  bool fits = total * 1000 <= routine.matchLength;
+  bool replay = routine.count > 0 && routine.steps[0].kind == stepReplay;
+  printf("%-12s %6.2f s of %2lu s%s, %d plan%s off by >%.0f%%\n", routine.name,
+         total, (unsigned long)(routine.matchLength / 1000),
+         replay ? " (replay not estimated)" : (fits ? "" : "  DOESN'T FIT"),
+         offPlan, offPlan == 1 ? "" : "s", planTolerance * 100);
+
+  // Each mechanism step only once, with whichever neighbour saves more
+  std::vector<bool> shown(routine.count, false);
+  int count = 0;
+  for (size_t i = 0; i < overlaps.size() && count < 3; i++) {
+    const overlap &o = overlaps[i];
+    if (shown[o.mechanism] || o.saving < 0.1)
+      continue;
+    shown[o.mechanism] = true;
+    count += 1;
+    printf("             overlap %s step %d with %s step %d: saves %.2f s\n",
+           stepKindNames[routine.steps[o.mechanism].kind], o.mechanism,
+           stepKindNames[routine.steps[o.chassis].kind], o.chassis, o.saving);
+  }
+  return fits && offPlan == 0;
+}
+
+int main(int argc, char **argv) {
+  bool verbose = argc > 1 && strcmp(argv[1], "-v") == 0;
+
+  bool allGood = true;
+  for (int i = 0; i < autonRoutineCount; i++)
+    if (!estimate(*autonRoutines[i], verbose))
+      allGood = false;
+  return allGood ? 0 : 1;
+}
@@ -0,0 +1,55 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       ff-fit.cpp                                                */
+/*    Author:       64846B                                                    */
+/*    Created:      Mon Oct 19 2026                                           */
+/*    Description:  Host fitter for ff-linear.csv / ff-angular.csv logs       */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+// Fits kS/kV/kA from characterization logs copied off the SD card, using
+// the same fit as the robot. Build with the makefile in this folder:
+//    make ff-fit
+//    ./ff-fit ff-linear.csv [minVelocity]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "ff-fit.h"
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s log.csv [minVelocity]\n", argv[0]);
+    return 1;
+  }
+
+  FILE *file = fopen(argv[1], "r");
+  if (file == NULL) {
+    perror(argv[1]);
+    return 1;
+  }
+  double minVelocity = argc > 2 ? atof(argv[2]) : 0.5;
+
+  std::vector<ffSample> samples;
+  char line[128];
+  while (fgets(line, sizeof(line), file) != NULL) {
+    ffSample sample;
+    // the header line doesn't parse and is skipped
+    if (sscanf(line, "%f,%f,%f", &sample.time, &sample.volts,
+               &sample.velocity) == 3)
+      samples.push_back(sample);
+  }
+  fclose(file);
+
+  ffFit fit = ffFitSamples(samples.data(), (int)samples.size(), minVelocity);
+  if (fit.used < 3) {
+    fprintf(stderr, "not enough moving samples in %s\n", argv[1]);
+    return 1;
+  }
+
+  printf("samples %d (of %d)\n", fit.used, (int)samples.size());
+  printf("kS %.5f\nkV %.5f\nkA %.5f\nR^2 %.4f\n", fit.kS, fit.kV, fit.kA,
+         fit.rSquared);
+  return 0;
+}